@@ -8,8 +8,16 @@ namespace jive
             if (dynamic_cast<TextComponent*>(getParentComponent()) != nullptr)
                 return;
 
-            getAttributedString()
-                .draw(g, getLocalBounds().toFloat());
+            const auto& textToDraw = getCachedAttributedString();
+            const auto area = getLocalBounds().toFloat();
+
+            if (textToDraw.getText().isEmpty() || !g.clipRegionIntersects(area.getSmallestIntegerContainer()))
+                return;
+
+            // As in juce::AttributedString::draw(), the graphics context may
+            // draw the text natively, e.g. with CoreText on macOS.
+            if (!g.getInternalContext().drawTextLayout(textToDraw, area))
+                getLayout().draw(g, area);
         };
         canvas.setAlwaysOnTop(true);
         canvas.setBufferedToImage(true);
@@ -20,6 +28,7 @@ namespace jive
 
     void TextComponent::resized()
     {
+        layout = nullptr;
         canvas.setBounds(getLocalBounds());
     }
 
@@ -33,7 +42,7 @@ namespace jive
         if (newText != text)
         {
             text = newText;
-            canvas.repaint();
+            textChanged();
         }
     }
 
@@ -47,8 +56,8 @@ namespace jive
         if (newFont != font)
         {
             font = newFont;
+            textChanged();
             listeners.call(&Listener::textFontChanged, *this);
-            canvas.repaint();
         }
     }
 
@@ -57,7 +66,7 @@ namespace jive
         if (newJustification != justification)
         {
             justification = newJustification;
-            canvas.repaint();
+            textChanged();
         }
     }
 
@@ -66,7 +75,7 @@ namespace jive
         if (newWordWrap != wordWrap)
         {
             wordWrap = newWordWrap;
-            canvas.repaint();
+            textChanged();
         }
     }
 
@@ -75,7 +84,7 @@ namespace jive
         if (newDirection != direction)
         {
             direction = newDirection;
-            canvas.repaint();
+            textChanged();
         }
     }
 
@@ -84,7 +93,7 @@ namespace jive
         if (newLineSpacing != lineSpacing)
         {
             lineSpacing = newLineSpacing;
-            canvas.repaint();
+            textChanged();
         }
     }
 
@@ -93,39 +102,47 @@ namespace jive
         if (newColour != textColour)
         {
             textColour = newColour;
-            canvas.repaint();
+            textChanged();
         }
     }
 
     void TextComponent::clearAttributes()
     {
         appendices.clear();
-        canvas.repaint();
+        textChanged();
     }
 
     void TextComponent::append(const juce::AttributedString& attributedStringToAppend)
     {
         appendices.add(attributedStringToAppend);
-        canvas.repaint();
+        textChanged();
     }
 
     juce::AttributedString TextComponent::getAttributedString() const
     {
-        juce::AttributedString attributedString;
+        return getCachedAttributedString();
+    }
+
+    const juce::AttributedString& TextComponent::getCachedAttributedString() const
+    {
+        if (attributedString.has_value())
+            return *attributedString;
 
-        attributedString.setText(text);
+        attributedString.emplace();
 
-        attributedString.setColour(textColour);
-        attributedString.setFont(font);
-        attributedString.setJustification(justification);
-        attributedString.setLineSpacing(lineSpacing);
-        attributedString.setReadingDirection(direction);
-        attributedString.setWordWrap(wordWrap);
+        attributedString->setText(text);
+
+        attributedString->setColour(textColour);
+        attributedString->setFont(font);
+        attributedString->setJustification(justification);
+        attributedString->setLineSpacing(lineSpacing);
+        attributedString->setReadingDirection(direction);
+        attributedString->setWordWrap(wordWrap);
 
         for (const auto& appendix : appendices)
-            attributedString.append(appendix);
+            attributedString->append(appendix);
 
-        return attributedString;
+        return *attributedString;
     }
 
     void TextComponent::addListener(Listener& listener) const
@@ -209,4 +226,76 @@ namespace jive
     {
         return std::make_unique<AccessibilityHandler>(*this);
     }
+
+    void TextComponent::textChanged()
+    {
+        attributedString.reset();
+        layout = nullptr;
+        canvas.repaint();
+    }
+
+    const juce::TextLayout& TextComponent::getLayout() const
+    {
+        // Equivalent to juce::AttributedString::draw(), which lays the text
+        // out again every time it's drawn.
+        if (layout == nullptr)
+            layout = TextLayoutCache::getLayout(getCachedAttributedString(), static_cast<float>(getWidth()));
+
+        return *layout;
+    }
 } // namespace jive
+
+#if JIVE_UNIT_TESTS
+class TextComponentUnitTest : public juce::UnitTest
+{
+public:
+    TextComponentUnitTest()
+        : juce::UnitTest{ "jive::TextComponent", "jive" }
+    {
+    }
+
+    void runTest() final
+    {
+        testCachedText();
+    }
+
+private:
+    void testCachedText()
+    {
+        beginTest("cached text");
+
+        jive::TextComponent text;
+        text.setText("Input");
+        text.setSize(100, 20);
+        expectEquals<juce::String>(text.getAttributedString().getText(), "Input");
+
+        jive::TextLayoutCache::clear();
+        juce::Image image{ juce::Image::ARGB, 100, 20, true };
+        juce::Graphics g{ image };
+
+        for (auto i = 0; i < 3; i++)
+            text.paintEntireComponent(g, false);
+
+        expectLessOrEqual(jive::TextLayoutCache::getStatistics().misses
+                              + jive::TextLayoutCache::getStatistics().hits,
+                          1);
+
+        text.setText("Output");
+        expectEquals<juce::String>(text.getAttributedString().getText(), "Output");
+
+        text.setJustification(juce::Justification::centred);
+        expect(text.getAttributedString().getJustification() == juce::Justification::centred);
+
+        text.setFont(juce::Font{ 30.0f });
+        expectEquals(text.getAttributedString().getAttribute(0).font.getHeight(), 30.0f);
+
+        text.append(juce::AttributedString{ "!" });
+        expectEquals<juce::String>(text.getAttributedString().getText(), "Output!");
+
+        text.clearAttributes();
+        expectEquals<juce::String>(text.getAttributedString().getText(), "Output");
+    }
+};
+
+static TextComponentUnitTest textComponentUnitTest;
+#endif
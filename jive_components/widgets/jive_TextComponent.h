@@ -40,6 +40,10 @@ namespace jive
     private:
         std::unique_ptr<juce::AccessibilityHandler> createAccessibilityHandler() override;
 
+        void textChanged();
+        const juce::AttributedString& getCachedAttributedString() const;
+        const juce::TextLayout& getLayout() const;
+
         juce::AttributedString::ReadingDirection direction{ juce::AttributedString::ReadingDirection::natural };
         juce::Font font;
         juce::Justification justification{ juce::Justification::topLeft };
@@ -49,6 +53,11 @@ namespace jive
         juce::AttributedString::WordWrap wordWrap{ juce::AttributedString::WordWrap::byWord };
         juce::Array<juce::AttributedString> appendices;
 
+        // Built on demand and kept until the text or its size changes, so
+        // repainting static text doesn't lay it out again.
+        mutable std::optional<juce::AttributedString> attributedString;
+        mutable std::shared_ptr<const juce::TextLayout> layout;
+
         Canvas canvas;
 
         mutable juce::ListenerList<Listener> listeners;
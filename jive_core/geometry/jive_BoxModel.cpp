@@ -10,30 +10,26 @@ namespace jive
         , minHeight{ state, "min-height" }
         , idealWidth{ state, "ideal-width" }
         , idealHeight{ state, "ideal-height" }
-        , componentSize{ state, "component-size" }
         , padding{ state, "padding" }
         , border{ state, "border-width" }
         , margin{ state, "margin" }
         , isValid{ state, "box-model-valid", true }
+        , node{ LayoutNodeStore::getInstance().acquire(state) }
     {
-        componentSize = juce::Rectangle{
-            calculateComponentWidth(),
-            calculateComponentHeight(),
-        };
+        setComponentSize(calculateComponentWidth(), calculateComponentHeight());
+        LayoutNodeStore::getInstance().addListener(node, *this);
 
         const auto onBoxModelChanged = [this]() {
-            isValid = true;
-            listeners.call(&Listener::boxModelChanged, *this);
-            invalidateParent();
+            notifyBoxModelChanged();
+            invalidateParent(Invalidation::contentChanged);
         };
         const auto recalculateSize = [this, onBoxModelChanged]() {
-            const auto sizeBefore = componentSize.get();
-            componentSize = juce::Rectangle{
-                calculateComponentWidth(),
-                calculateComponentHeight(),
-            };
+            JIVE_LAYOUT_STATS_SCOPE(boxModelRecalculation, state);
 
-            if (componentSize.get() == sizeBefore)
+            const auto sizeBefore = getBounds();
+            setComponentSize(calculateComponentWidth(), calculateComponentHeight());
+
+            if (getBounds() == sizeBefore)
                 onBoxModelChanged();
         };
 
@@ -43,19 +39,35 @@ namespace jive
         border.onValueChange = recalculateSize;
         margin.onValueChange = recalculateSize;
 
-        idealWidth.onValueChange = onBoxModelChanged;
-        idealHeight.onValueChange = onBoxModelChanged;
-        componentSize.onValueChange = onBoxModelChanged;
+        // A relayout boundary's size doesn't depend on its content, so its
+        // ideal size changing doesn't affect its parent.
+        const auto onIdealSizeChanged = [this]() {
+            notifyBoxModelChanged();
+
+            if (!isRelayoutBoundary())
+                invalidateParent(Invalidation::contentChanged);
+        };
+        idealWidth.onValueChange = onIdealSizeChanged;
+        idealHeight.onValueChange = onIdealSizeChanged;
 
         isValid.onValueChange = [this]() {
             if (!isValid.get())
-                listeners.call(&Listener::boxModelInvalidated, *this);
+                notifyBoxModelInvalidated(Invalidation::contentChanged);
         };
     }
 
+    BoxModel::~BoxModel()
+    {
+        StateTransaction::cancelCall(this);
+
+        auto& store = LayoutNodeStore::getInstance();
+        store.removeListener(node, *this);
+        store.release(node);
+    }
+
     float BoxModel::getWidth() const
     {
-        return componentSize.get().getWidth();
+        return LayoutNodeStore::getInstance().getWidth(node);
     }
 
     bool BoxModel::hasAutoWidth() const
@@ -65,7 +77,7 @@ namespace jive
 
     float BoxModel::getHeight() const
     {
-        return componentSize.get().getHeight();
+        return LayoutNodeStore::getInstance().getHeight(node);
     }
 
     bool BoxModel::hasAutoHeight() const
@@ -75,7 +87,10 @@ namespace jive
 
     void BoxModel::setSize(float newWidth, float newHeight)
     {
-        componentSize = juce::Rectangle{ newWidth, newHeight };
+        {
+            const juce::ScopedValueSetter<bool> resizing{ isBeingResized, true };
+            setComponentSize(newWidth, newHeight);
+        }
 
         if (!state.getParent().isValid())
         {
@@ -101,25 +116,26 @@ namespace jive
 
     juce::Rectangle<float> BoxModel::getBounds() const
     {
-        return componentSize.get();
+        return LayoutNodeStore::getInstance().getBounds(node);
     }
 
     juce::Rectangle<float> BoxModel::getParentBounds() const
     {
         if (state.getParent().isValid())
-        {
-            const Property<juce::Rectangle<float>> parentSize{ state.getParent(), componentSize.id };
-            return parentSize.get();
-        }
+            return BoxModelView{ state.getParent() }.getBounds();
 
         return juce::Rectangle<float>{};
     }
 
     juce::Rectangle<float> BoxModel::getMinimumBounds() const
     {
+        if (!minWidth.isPercent() && !minHeight.isPercent())
+            return juce::Rectangle<float>{ minWidth.toPixels({}), minHeight.toPixels({}) };
+
+        const auto parentBounds = getParentBounds();
         return juce::Rectangle<float>{
-            minWidth.toPixels(getParentBounds()),
-            minHeight.toPixels(getParentBounds()),
+            minWidth.toPixels(parentBounds),
+            minHeight.toPixels(parentBounds),
         };
     }
 
@@ -147,6 +163,9 @@ namespace jive
         if (width.isAuto())
             return padding.get().getLeftAndRight() + border.get().getLeftAndRight();
 
+        if (width.isPixels())
+            return width.toPixels({});
+
         return width.toPixels(getParentBounds());
     }
 
@@ -155,18 +174,94 @@ namespace jive
         if (height.isAuto())
             return padding.get().getTopAndBottom() + border.get().getTopAndBottom();
 
+        if (height.isPixels())
+            return height.toPixels({});
+
         return height.toPixels(getParentBounds());
     }
 
-    void BoxModel::invalidateParent()
+    bool BoxModel::isRelayoutBoundary() const
     {
         if (!state.getParent().isValid())
-            return;
+            return true;
+
+        return (!width.isAuto() && !height.isAuto()) || !parentSizesToContent();
+    }
+
+    bool BoxModel::parentSizesToContent() const
+    {
+        static const juce::Identifier displayID{ "display" };
+        return state.getParent()[displayID].toString() != "block";
+    }
+
+    int BoxModel::getNumNotifications()
+    {
+        return getNumNotificationsCounter();
+    }
 
-        BoxModel parent{ state.getParent() };
+    void BoxModel::resetNumNotifications()
+    {
+        getNumNotificationsCounter() = 0;
+    }
 
-        parent.isValid = true;
-        parent.isValid = false;
+    int& BoxModel::getNumNotificationsCounter()
+    {
+        static int numNotifications = 0;
+        return numNotifications;
+    }
+
+    void BoxModel::setComponentSize(float newWidth, float newHeight)
+    {
+        LayoutNodeStore::getInstance().setSize(node, newWidth, newHeight);
+    }
+
+    void BoxModel::layoutNodeResized(LayoutNodeStore::Node)
+    {
+        const auto wasResizedByLayout = isBeingResized;
+        notifyBoxModelChanged();
+        invalidateParent(wasResizedByLayout ? Invalidation::childResized : Invalidation::contentChanged);
+    }
+
+    void BoxModel::layoutNodeInvalidated(LayoutNodeStore::Node, Invalidation invalidation)
+    {
+        if (pendingInvalidation != Invalidation::contentChanged)
+            pendingInvalidation = invalidation;
+
+        // Within a transaction, the listeners are only told once it's
+        // committed, like any other property change.
+        static constexpr auto invalidationsBeforeIdealSizes = -2;
+        StateTransaction::callWhenCommitted(this,
+                                            invalidationsBeforeIdealSizes,
+                                            [this]() {
+                                                if (const auto pending = std::exchange(pendingInvalidation, std::nullopt))
+                                                    notifyBoxModelInvalidated(*pending);
+                                            });
+    }
+
+    void BoxModel::notifyBoxModelChanged()
+    {
+        isValid = true;
+        getNumNotificationsCounter()++;
+        listeners.call(&Listener::boxModelChanged, *this);
+    }
+
+    void BoxModel::notifyBoxModelInvalidated(Invalidation invalidation)
+    {
+        getNumNotificationsCounter()++;
+        listeners.call(&Listener::boxModelInvalidated, *this, invalidation);
+    }
+
+    void BoxModel::invalidateParent(Invalidation invalidation)
+    {
+        // Only the box models that already exist for the parent have anyone
+        // listening to them.
+        auto& store = LayoutNodeStore::getInstance();
+
+        if (const auto parentNode = store.find(state.getParent());
+            parentNode != LayoutNodeStore::invalidNode)
+        {
+            store.invalidate(parentNode, invalidation);
+        }
     }
 } // namespace jive
 
@@ -186,6 +281,9 @@ public:
         testBorder();
         testMargin();
         testContentBounds();
+        testRelayoutBoundaries();
+        testBlockChildBoundaries();
+        testInvalidations();
     }
 
 private:
@@ -317,6 +415,175 @@ private:
                          150.0f - 30.0f - 30.0f - 5.0f - 15.0f,
                      });
     }
+
+    struct InvalidationCounter : public jive::BoxModel::Listener
+    {
+        void boxModelInvalidated(jive::BoxModel&, jive::BoxModel::Invalidation invalidation) final
+        {
+            numInvalidations++;
+            lastInvalidation = invalidation;
+        }
+
+        int numInvalidations = 0;
+        std::optional<jive::BoxModel::Invalidation> lastInvalidation;
+    };
+
+    void testRelayoutBoundaries()
+    {
+        beginTest("relayout boundaries");
+
+        juce::ValueTree textState{
+            "Text",
+            {
+                { "text", "Lorem" },
+            },
+        };
+        juce::ValueTree panelState{
+            "Component",
+            {
+                { "width", 200 },
+                { "height", 200 },
+            },
+            {
+                juce::ValueTree{
+                    "Component",
+                    {},
+                    {
+                        textState,
+                    },
+                },
+            },
+        };
+        juce::ValueTree state{
+            "Component",
+            {
+                { "width", 400 },
+                { "height", 400 },
+                { "align-items", "flex-start" },
+            },
+            {
+                panelState,
+            },
+        };
+        jive::Interpreter interpreter;
+        const auto item = interpreter.interpret(state);
+
+        expect(jive::BoxModel{ state }.isRelayoutBoundary());
+        expect(jive::BoxModel{ panelState }.isRelayoutBoundary());
+
+        InvalidationCounter counter;
+        jive::BoxModel rootBox{ state };
+        rootBox.addListener(counter);
+
+        jive::BoxModel::resetNumNotifications();
+        textState.setProperty("text", "Lorem ipsum dolor sit amet", nullptr);
+        const auto numNotificationsWithinBoundary = jive::BoxModel::getNumNotifications();
+        expectGreaterThan(numNotificationsWithinBoundary, 0);
+        expectEquals(counter.numInvalidations, 0);
+
+        panelState.setProperty("width", "auto", nullptr);
+        panelState.setProperty("height", "auto", nullptr);
+
+        counter.numInvalidations = 0;
+        jive::BoxModel::resetNumNotifications();
+        textState.setProperty("text", "Lorem ipsum", nullptr);
+        expectGreaterThan(counter.numInvalidations, 0);
+        expectGreaterThan(jive::BoxModel::getNumNotifications(), numNotificationsWithinBoundary);
+
+        rootBox.removeListener(counter);
+    }
+
+    void testBlockChildBoundaries()
+    {
+        beginTest("block child boundaries");
+
+        juce::ValueTree textState{
+            "Text",
+            {
+                { "text", "Lorem" },
+            },
+        };
+        juce::ValueTree blockState{
+            "Component",
+            {
+                { "display", "block" },
+            },
+            {
+                textState,
+            },
+        };
+        juce::ValueTree state{
+            "Component",
+            {
+                { "width", 400 },
+                { "height", 400 },
+            },
+            {
+                blockState,
+            },
+        };
+        jive::Interpreter interpreter;
+        const auto item = interpreter.interpret(state);
+
+        // A block container places its children without reading their ideal
+        // sizes, so its children are boundaries whatever their own sizes.
+        expect(!jive::BoxModel{ blockState }.isRelayoutBoundary());
+        expect(jive::BoxModel{ textState }.isRelayoutBoundary());
+
+        InvalidationCounter counter;
+        jive::BoxModel blockBox{ blockState };
+        blockBox.addListener(counter);
+
+        textState.setProperty("text", "Lorem ipsum dolor sit amet", nullptr);
+        expectEquals(counter.numInvalidations, 0);
+
+        blockBox.removeListener(counter);
+    }
+
+    void testInvalidations()
+    {
+        beginTest("invalidations");
+
+        juce::ValueTree childState{ "Component" };
+        juce::ValueTree state{
+            "Component",
+            {
+                { "width", 100 },
+                { "height", 100 },
+            },
+            {
+                childState,
+            },
+        };
+
+        jive::BoxModel box{ state };
+        jive::BoxModel childBox{ childState };
+        InvalidationCounter counter;
+        box.addListener(counter);
+
+        childBox.setSize(10.0f, 20.0f);
+        expectEquals(counter.numInvalidations, 1);
+        expect(counter.lastInvalidation == jive::BoxModel::Invalidation::childResized);
+
+        childState.setProperty("width", 30, nullptr);
+        expectEquals(counter.numInvalidations, 2);
+        expect(counter.lastInvalidation == jive::BoxModel::Invalidation::contentChanged);
+
+        // Within a transaction, the parent is only invalidated once, and not
+        // just for a resize if anything else changed too.
+        {
+            jive::StateTransaction transaction;
+            childBox.setSize(40.0f, 50.0f);
+            childState.setProperty("padding", 5, nullptr);
+            childBox.setSize(60.0f, 70.0f);
+            expectEquals(counter.numInvalidations, 2);
+        }
+
+        expectEquals(counter.numInvalidations, 3);
+        expect(counter.lastInvalidation == jive::BoxModel::Invalidation::contentChanged);
+
+        box.removeListener(counter);
+    }
 };
 
 static BoxModelUnitTest boxModelUnitTest;
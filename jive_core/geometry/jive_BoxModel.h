@@ -2,18 +2,21 @@
 
 namespace jive
 {
-    class BoxModel
+    class BoxModel : private LayoutNodeStore::Listener
     {
     public:
+        using Invalidation = LayoutNodeStore::Invalidation;
+
         struct Listener
         {
             virtual ~Listener() = default;
 
             virtual void boxModelChanged(BoxModel&) {}
-            virtual void boxModelInvalidated(BoxModel&) {}
+            virtual void boxModelInvalidated(BoxModel&, Invalidation) {}
         };
 
         explicit BoxModel(juce::ValueTree sourceState);
+        ~BoxModel() override;
 
         float getWidth() const;
         bool hasAutoWidth() const;
@@ -32,13 +35,36 @@ namespace jive
         void addListener(Listener& listener) const;
         void removeListener(Listener& listener) const;
 
+        // A box whose width and height are both given explicitly, in pixels
+        // or relative to its parent, or that has no parent, doesn't depend on
+        // its content for its size. Nor does anything outside a box whose
+        // parent doesn't size itself to its content, such as a block
+        // container, which places its children without reading their ideal
+        // sizes. Changes to a boundary's ideal size are therefore not passed
+        // on to its parent.
+        bool isRelayoutBoundary() const;
+
+        // The number of box models that have been notified of a change, or
+        // invalidated by one of their children, since the count was last
+        // reset. Useful for seeing how far a change spreads through a tree.
+        static int getNumNotifications();
+        static void resetNumNotifications();
+
         juce::ValueTree state;
 
     private:
         juce::Rectangle<float> getParentBounds() const;
         float calculateComponentWidth() const;
         float calculateComponentHeight() const;
-        void invalidateParent();
+        void setComponentSize(float newWidth, float newHeight);
+        bool parentSizesToContent() const;
+        void layoutNodeResized(LayoutNodeStore::Node) override;
+        void layoutNodeInvalidated(LayoutNodeStore::Node, Invalidation invalidation) override;
+        void notifyBoxModelChanged();
+        void notifyBoxModelInvalidated(Invalidation invalidation);
+        void invalidateParent(Invalidation invalidation);
+
+        static int& getNumNotificationsCounter();
 
         Length width;
         Length height;
@@ -46,14 +72,22 @@ namespace jive
         Length minHeight;
         Property<float> idealWidth;
         Property<float> idealHeight;
-        Property<juce::Rectangle<float>> componentSize;
-        Property<juce::BorderSize<float>> padding;
-        Property<juce::BorderSize<float>> border;
-        Property<juce::BorderSize<float>> margin;
+        CachedProperty<juce::BorderSize<float>> padding;
+        CachedProperty<juce::BorderSize<float>> border;
+        CachedProperty<juce::BorderSize<float>> margin;
         Property<bool> isValid;
 
+        // The computed size is kept in the layout-node store, shared with any
+        // other box models for the same tree, rather than in the tree itself.
+        const LayoutNodeStore::Node node;
+
         juce::ListenerList<Listener> listeners;
+        bool isBeingResized{ false };
+
+        // Invalidations made during a transaction are combined into one,
+        // which is only for a resized child if all of them were.
+        std::optional<Invalidation> pendingInvalidation;
 
-        JUCE_LEAK_DETECTOR(BoxModel)
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(BoxModel)
     };
 } // namespace jive
@@ -0,0 +1,228 @@
+#include <jive_core/jive_core.h>
+
+namespace jive
+{
+    namespace boxModelProperties
+    {
+        static const juce::Identifier componentSize{ "component-size" };
+        static const juce::Identifier padding{ "padding" };
+        static const juce::Identifier border{ "border-width" };
+        static const juce::Identifier margin{ "margin" };
+    } // namespace boxModelProperties
+
+    // Reads up to maxValues whitespace-separated numbers from the given value
+    // into the given array, returning the total number of tokens found. Tokens
+    // are parsed the same way as String::getDoubleValue() does, as the
+    // variant converters do, but without building a StringArray.
+    static int readNumbers(const juce::var& value, float* values, int maxValues)
+    {
+        if (value.isVoid())
+            return 0;
+
+        if (!value.isString())
+        {
+            values[0] = static_cast<float>(value);
+            return 1;
+        }
+
+        const auto text = value.toString();
+        auto numTokens = 0;
+
+        for (auto character = text.getCharPointer();;)
+        {
+            character.incrementToEndOfWhitespace();
+
+            if (character.isEmpty())
+                break;
+
+            if (numTokens < maxValues)
+            {
+                auto number = character;
+                values[numTokens] = static_cast<float>(juce::CharacterFunctions::readDoubleValue(number));
+            }
+
+            numTokens++;
+
+            while (!character.isEmpty() && !character.isWhitespace())
+                ++character;
+        }
+
+        return numTokens;
+    }
+
+    BoxModelView::BoxModelView(const juce::ValueTree& sourceState)
+        : state{ sourceState }
+    {
+    }
+
+    juce::Rectangle<float> BoxModelView::getBounds() const
+    {
+        const auto& store = LayoutNodeStore::getInstance();
+
+        if (const auto node = store.find(state); node != LayoutNodeStore::invalidNode)
+            return store.getBounds(node);
+
+        // Trees without a box model only have a size if one was mirrored to,
+        // or written into, the tree.
+        float values[4]{};
+        readNumbers(state[boxModelProperties::componentSize], values, 4);
+
+        return { values[0], values[1], values[2], values[3] };
+    }
+
+    juce::Rectangle<float> BoxModelView::getContentBounds() const
+    {
+        return getPadding().subtractedFrom(getBorder().subtractedFrom(getBounds()));
+    }
+
+    juce::BorderSize<float> BoxModelView::getPadding() const
+    {
+        return getBorderSize(boxModelProperties::padding);
+    }
+
+    juce::BorderSize<float> BoxModelView::getBorder() const
+    {
+        return getBorderSize(boxModelProperties::border);
+    }
+
+    juce::BorderSize<float> BoxModelView::getMargin() const
+    {
+        return getBorderSize(boxModelProperties::margin);
+    }
+
+    juce::BorderSize<float> BoxModelView::getBorderSize(const juce::Identifier& propertyID) const
+    {
+        float values[4]{};
+
+        switch (readNumbers(state[propertyID], values, 4))
+        {
+        case 1:
+            return juce::BorderSize<float>{ values[0] };
+        case 2:
+            return juce::BorderSize<float>{ values[0], values[1], values[0], values[1] };
+        case 3:
+            return juce::BorderSize<float>{ values[0], values[1], values[2], values[1] };
+        case 4:
+            return juce::BorderSize<float>{ values[0], values[3], values[2], values[1] };
+        default:
+            return juce::BorderSize<float>{};
+        }
+    }
+} // namespace jive
+
+#if JIVE_UNIT_TESTS
+class BoxModelViewUnitTest : public juce::UnitTest
+{
+public:
+    BoxModelViewUnitTest()
+        : juce::UnitTest{ "jive::BoxModelView", "jive" }
+    {
+    }
+
+    void runTest() final
+    {
+        testBorderSizes();
+        testBounds();
+        testReadOnly();
+    }
+
+private:
+    void testBorderSizes()
+    {
+        beginTest("border sizes");
+
+        for (const auto& value : juce::Array<juce::var>{
+                 juce::var{},
+                 12,
+                 3.5,
+                 "7",
+                 " 4.5 ",
+                 "1 2",
+                 "1 2 3",
+                 "1 2 3 4",
+                 "1px  2px\t3px 4px",
+                 "1 2 3 4 5",
+             })
+        {
+            const juce::ValueTree tree{
+                "Component",
+                {
+                    { "padding", value },
+                    { "border-width", value },
+                    { "margin", value },
+                },
+            };
+            const jive::BoxModelView view{ tree };
+            const auto expected = juce::VariantConverter<juce::BorderSize<float>>::fromVar(value);
+
+            expect(view.getPadding() == expected, value.toString());
+            expect(view.getBorder() == expected, value.toString());
+            expect(view.getMargin() == expected, value.toString());
+        }
+    }
+
+    void testBounds()
+    {
+        beginTest("bounds");
+
+        juce::ValueTree tree{
+            "Component",
+            {
+                { "width", 200 },
+                { "height", 150 },
+                { "padding", "5 10" },
+                { "border-width", 2 },
+            },
+        };
+        const jive::BoxModel boxModel{ tree };
+        const jive::BoxModelView view{ tree };
+        expectEquals(view.getBounds(), boxModel.getBounds());
+        expectEquals(view.getContentBounds(), boxModel.getContentBounds());
+        expectEquals(view.getContentBounds(), juce::Rectangle{ 12.0f, 7.0f, 176.0f, 136.0f });
+
+        const juce::ValueTree withoutBoxModel{ "Component", { { "component-size", "1 2 30.5 40" } } };
+        expectEquals(jive::BoxModelView{ withoutBoxModel }.getBounds(), juce::Rectangle{ 1.0f, 2.0f, 30.5f, 40.0f });
+
+        expectEquals(jive::BoxModelView{ juce::ValueTree{ "Component" } }.getContentBounds(),
+                     juce::Rectangle<float>{});
+    }
+
+    void testReadOnly()
+    {
+        beginTest("read-only");
+
+        struct ChangeCounter : public juce::ValueTree::Listener
+        {
+            void valueTreePropertyChanged(juce::ValueTree&, const juce::Identifier&) final
+            {
+                numChanges++;
+            }
+
+            int numChanges = 0;
+        };
+
+        juce::ValueTree tree{
+            "Component",
+            {
+                { "width", "50%" },
+                { "padding", 10 },
+            },
+        };
+        ChangeCounter counter;
+        tree.addListener(&counter);
+
+        {
+            const jive::BoxModelView view{ tree };
+            view.getContentBounds();
+            view.getMargin();
+        }
+
+        expectEquals(counter.numChanges, 0);
+        expect(!tree.hasProperty("component-size"));
+
+        tree.removeListener(&counter);
+    }
+};
+
+static BoxModelViewUnitTest boxModelViewUnitTest;
+#endif
@@ -0,0 +1,28 @@
+#pragma once
+
+namespace jive
+{
+    // A read-only view of the box model of a tree. Unlike BoxModel, it
+    // neither listens to the tree nor writes to it, and reading from it
+    // doesn't allocate, so it's cheap enough to create whenever a layout
+    // needs to know the bounds of some other item.
+    class BoxModelView
+    {
+    public:
+        explicit BoxModelView(const juce::ValueTree& sourceState);
+
+        juce::Rectangle<float> getBounds() const;
+        juce::Rectangle<float> getContentBounds() const;
+
+        juce::BorderSize<float> getPadding() const;
+        juce::BorderSize<float> getBorder() const;
+        juce::BorderSize<float> getMargin() const;
+
+    private:
+        juce::BorderSize<float> getBorderSize(const juce::Identifier& propertyID) const;
+
+        const juce::ValueTree state;
+
+        JUCE_LEAK_DETECTOR(BoxModelView)
+    };
+} // namespace jive
@@ -0,0 +1,274 @@
+#include <jive_core/jive_core.h>
+
+namespace jive
+{
+    LayoutNodeStore::Node LayoutNodeStore::acquire(const juce::ValueTree& tree)
+    {
+        jassert(tree.isValid());
+
+        if (const auto node = find(tree); node != invalidNode)
+        {
+            referenceCounts[static_cast<std::size_t>(node)]++;
+            return node;
+        }
+
+        Node node;
+
+        if (freeNodes.empty())
+        {
+            node = static_cast<Node>(widths.size());
+
+            widths.push_back(0.0f);
+            heights.push_back(0.0f);
+            referenceCounts.push_back(0);
+            trees.emplace_back();
+            listeners.push_back(std::make_unique<juce::ListenerList<Listener>>());
+        }
+        else
+        {
+            node = freeNodes.back();
+            freeNodes.pop_back();
+        }
+
+        const auto index = static_cast<std::size_t>(node);
+        widths[index] = 0.0f;
+        heights[index] = 0.0f;
+        referenceCounts[index] = 1;
+        trees[index] = tree;
+
+        nodesByTree[&tree.getProperties()] = node;
+
+        return node;
+    }
+
+    void LayoutNodeStore::release(Node node)
+    {
+        const auto index = static_cast<std::size_t>(node);
+        jassert(index < referenceCounts.size() && referenceCounts[index] > 0);
+
+        if (--referenceCounts[index] > 0)
+            return;
+
+        jassert(listeners[index]->isEmpty());
+
+        nodesByTree.erase(&trees[index].getProperties());
+        trees[index] = juce::ValueTree{};
+        freeNodes.push_back(node);
+    }
+
+    LayoutNodeStore::Node LayoutNodeStore::find(const juce::ValueTree& tree) const
+    {
+        if (!tree.isValid())
+            return invalidNode;
+
+        // A tree's properties live as long as the tree does, and each node
+        // keeps its tree alive, so their address identifies the tree.
+        if (const auto node = nodesByTree.find(&tree.getProperties());
+            node != std::end(nodesByTree))
+        {
+            return node->second;
+        }
+
+        return invalidNode;
+    }
+
+    float LayoutNodeStore::getWidth(Node node) const
+    {
+        return widths[static_cast<std::size_t>(node)];
+    }
+
+    float LayoutNodeStore::getHeight(Node node) const
+    {
+        return heights[static_cast<std::size_t>(node)];
+    }
+
+    juce::Rectangle<float> LayoutNodeStore::getBounds(Node node) const
+    {
+        return { getWidth(node), getHeight(node) };
+    }
+
+    void LayoutNodeStore::setSize(Node node, float newWidth, float newHeight)
+    {
+        const auto index = static_cast<std::size_t>(node);
+
+        if (juce::Rectangle{ widths[index], heights[index] } == juce::Rectangle{ newWidth, newHeight })
+            return;
+
+        widths[index] = newWidth;
+        heights[index] = newHeight;
+
+        if (isMirroring)
+        {
+            trees[index].setProperty("component-size",
+                                     juce::VariantConverter<juce::Rectangle<float>>::toVar(getBounds(node)),
+                                     nullptr);
+        }
+
+        listeners[index]->call(&Listener::layoutNodeResized, node);
+    }
+
+    void LayoutNodeStore::invalidate(Node node, Invalidation invalidation)
+    {
+        listeners[static_cast<std::size_t>(node)]->call(&Listener::layoutNodeInvalidated, node, invalidation);
+    }
+
+    void LayoutNodeStore::addListener(Node node, Listener& listener)
+    {
+        listeners[static_cast<std::size_t>(node)]->add(&listener);
+    }
+
+    void LayoutNodeStore::removeListener(Node node, Listener& listener)
+    {
+        listeners[static_cast<std::size_t>(node)]->remove(&listener);
+    }
+
+    int LayoutNodeStore::getNumNodes() const
+    {
+        return static_cast<int>(nodesByTree.size());
+    }
+
+    void LayoutNodeStore::setMirroringEnabled(bool shouldMirrorToTrees)
+    {
+        isMirroring = shouldMirrorToTrees;
+    }
+
+    bool LayoutNodeStore::isMirroringEnabled() const
+    {
+        return isMirroring;
+    }
+
+    LayoutNodeStore& LayoutNodeStore::getInstance()
+    {
+        static LayoutNodeStore store;
+        return store;
+    }
+} // namespace jive
+
+#if JIVE_UNIT_TESTS
+class LayoutNodeStoreUnitTest : public juce::UnitTest
+{
+public:
+    LayoutNodeStoreUnitTest()
+        : juce::UnitTest{ "jive::LayoutNodeStore", "jive" }
+    {
+    }
+
+    void runTest() final
+    {
+        testSharedNodes();
+        testReleasedNodes();
+        testMirroring();
+        testBoxModels();
+    }
+
+private:
+    void testSharedNodes()
+    {
+        beginTest("shared nodes");
+
+        auto& store = jive::LayoutNodeStore::getInstance();
+        const auto numNodesBefore = store.getNumNodes();
+
+        juce::ValueTree tree{ "Component" };
+        const auto node = store.acquire(tree);
+        expectEquals(store.acquire(juce::ValueTree{ tree }), node);
+        expectEquals(store.find(tree), node);
+        expectEquals(store.getNumNodes(), numNodesBefore + 1);
+
+        const auto copy = tree.createCopy();
+        expectEquals(store.find(copy), jive::LayoutNodeStore::invalidNode);
+        expectEquals(store.find(juce::ValueTree{}), jive::LayoutNodeStore::invalidNode);
+
+        store.setSize(node, 12.0f, 34.0f);
+        expectEquals(store.getBounds(node), juce::Rectangle{ 12.0f, 34.0f });
+
+        store.release(node);
+        expectEquals(store.find(tree), node);
+
+        store.release(node);
+        expectEquals(store.find(tree), jive::LayoutNodeStore::invalidNode);
+        expectEquals(store.getNumNodes(), numNodesBefore);
+    }
+
+    void testReleasedNodes()
+    {
+        beginTest("released nodes");
+
+        auto& store = jive::LayoutNodeStore::getInstance();
+
+        const auto first = store.acquire(juce::ValueTree{ "Component" });
+        store.setSize(first, 100.0f, 200.0f);
+        store.release(first);
+
+        const auto second = store.acquire(juce::ValueTree{ "Component" });
+        expectEquals(second, first);
+        expectEquals(store.getBounds(second), juce::Rectangle<float>{});
+        store.release(second);
+    }
+
+    void testMirroring()
+    {
+        beginTest("mirroring");
+
+        auto& store = jive::LayoutNodeStore::getInstance();
+        juce::ValueTree tree{ "Component" };
+        const auto node = store.acquire(tree);
+
+        store.setSize(node, 10.0f, 20.0f);
+        expect(!tree.hasProperty("component-size"));
+
+        store.setMirroringEnabled(true);
+        store.setSize(node, 30.0f, 40.0f);
+        store.setMirroringEnabled(false);
+        expectEquals(juce::VariantConverter<juce::Rectangle<float>>::fromVar(tree["component-size"]),
+                     juce::Rectangle{ 30.0f, 40.0f });
+
+        store.release(node);
+    }
+
+    void testBoxModels()
+    {
+        beginTest("box models");
+
+        struct ChangeCounter : public juce::ValueTree::Listener
+        {
+            void valueTreePropertyChanged(juce::ValueTree&, const juce::Identifier&) final
+            {
+                numChanges++;
+            }
+
+            int numChanges = 0;
+        };
+
+        juce::ValueTree parent{ "Component" };
+        juce::ValueTree tree{
+            "Component",
+            {
+                { "width", 100 },
+                { "height", 50 },
+            },
+        };
+        parent.appendChild(tree, nullptr);
+
+        ChangeCounter counter;
+        tree.addListener(&counter);
+
+        {
+            jive::BoxModel boxModel{ tree };
+            expectEquals(boxModel.getBounds(), juce::Rectangle{ 100.0f, 50.0f });
+            expectEquals(jive::BoxModelView{ tree }.getBounds(), juce::Rectangle{ 100.0f, 50.0f });
+
+            const auto numChangesBefore = counter.numChanges;
+            boxModel.setSize(80.0f, 40.0f);
+            expectEquals(jive::BoxModelView{ tree }.getBounds(), juce::Rectangle{ 80.0f, 40.0f });
+            expectEquals(counter.numChanges, numChangesBefore);
+            expect(!tree.hasProperty("component-size"));
+        }
+
+        expectEquals(jive::LayoutNodeStore::getInstance().find(tree), jive::LayoutNodeStore::invalidNode);
+        tree.removeListener(&counter);
+    }
+};
+
+static LayoutNodeStoreUnitTest layoutNodeStoreUnitTest;
+#endif
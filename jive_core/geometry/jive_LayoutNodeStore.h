@@ -0,0 +1,73 @@
+#pragma once
+
+namespace jive
+{
+    // Holds the geometry computed for each box model in plain, contiguous
+    // arrays indexed by node, rather than as stringified properties of the
+    // box model's tree. Every box model for the same tree shares a node, which
+    // lives for as long as any of them do.
+    class LayoutNodeStore
+    {
+    public:
+        using Node = int;
+        static constexpr Node invalidNode = -1;
+
+        enum class Invalidation
+        {
+            // Something that determines the node's ideal size may have
+            // changed.
+            contentChanged,
+
+            // One of the node's children was given a new size, which doesn't
+            // change what the node measures.
+            childResized,
+        };
+
+        struct Listener
+        {
+            virtual ~Listener() = default;
+
+            virtual void layoutNodeResized(Node node) = 0;
+            virtual void layoutNodeInvalidated(Node, Invalidation) {}
+        };
+
+        Node acquire(const juce::ValueTree& tree);
+        void release(Node node);
+        Node find(const juce::ValueTree& tree) const;
+
+        float getWidth(Node node) const;
+        float getHeight(Node node) const;
+        juce::Rectangle<float> getBounds(Node node) const;
+        void setSize(Node node, float newWidth, float newHeight);
+        void invalidate(Node node, Invalidation invalidation);
+
+        void addListener(Node node, Listener& listener);
+        void removeListener(Node node, Listener& listener);
+
+        int getNumNodes() const;
+
+        // Nothing is written to the trees by default. For debugging, each
+        // node's size can also be written to the component-size property of
+        // its tree whenever it changes.
+        void setMirroringEnabled(bool shouldMirrorToTrees);
+        bool isMirroringEnabled() const;
+
+        static LayoutNodeStore& getInstance();
+
+    private:
+        LayoutNodeStore() = default;
+
+        std::vector<float> widths;
+        std::vector<float> heights;
+        std::vector<int> referenceCounts;
+        std::vector<juce::ValueTree> trees;
+        std::vector<std::unique_ptr<juce::ListenerList<Listener>>> listeners;
+
+        std::vector<Node> freeNodes;
+        std::unordered_map<const juce::NamedValueSet*, Node> nodesByTree;
+
+        bool isMirroring{ false };
+
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(LayoutNodeStore)
+    };
+} // namespace jive
@@ -4,36 +4,101 @@ namespace jive
 {
     const float Length::pixelValueWhenAuto = 0.0f;
 
+    Length::Length(juce::ValueTree sourceTree, const juce::Identifier& propertyID)
+        : Property{ sourceTree, propertyID }
+        , axis{ getAxis(propertyID) }
+    {
+    }
+
+    Length::Length(juce::ValueTree sourceTree,
+                   const juce::Identifier& propertyID,
+                   const juce::String& initialValue)
+        : Property{ sourceTree, propertyID, initialValue }
+        , axis{ getAxis(propertyID) }
+    {
+    }
+
     float Length::toPixels(const juce::Rectangle<float>& parentBounds) const
     {
-        if (isAuto())
+        const auto& length = compile();
+
+        switch (length.unit)
+        {
+        case Unit::automatic:
             return pixelValueWhenAuto;
+        case Unit::pixels:
+            return length.value;
+        case Unit::percent:
+            break;
+        }
+
+        jassert(tree.getParent().isValid());
 
-        if (isPixels())
-            return get().getFloatValue();
+        const auto relativeParentLength = axis == Axis::horizontal
+                                            ? static_cast<double>(parentBounds.getWidth())
+                                            : static_cast<double>(parentBounds.getHeight());
+        return static_cast<float>(static_cast<double>(length.value) * 0.01 * relativeParentLength);
+    }
 
-        const auto scale = static_cast<double>(get().getFloatValue()) * 0.01;
-        return static_cast<float>(scale * getRelativeParentLength(parentBounds.toDouble()));
+    bool Length::isAuto() const
+    {
+        return compile().unit == Unit::automatic;
     }
 
     bool Length::isPixels() const
     {
-        return !isAuto() && !isPercent();
+        return compile().unit == Unit::pixels;
     }
 
     bool Length::isPercent() const
     {
-        return !isAuto() && toString().endsWith("%");
+        return compile().unit == Unit::percent;
     }
 
-    double Length::getRelativeParentLength(const juce::Rectangle<double>& parentBounds) const
+    Length::Axis Length::getAxis(const juce::Identifier& propertyID)
     {
-        jassert(tree.getParent().isValid());
+        if (propertyID.toString().containsIgnoreCase("width") || propertyID.toString().containsIgnoreCase("x"))
+            return Axis::horizontal;
+
+        return Axis::vertical;
+    }
+
+    const Length::Compiled& Length::compile() const
+    {
+        const auto* source = tree.getPropertyPointer(id);
+
+        if (compiled.has_value()
+            && compiled->exists == (source != nullptr)
+            && (source == nullptr || isSameSource(compiled->source, *source)))
+        {
+            return *compiled;
+        }
+
+        compiled = Compiled{};
+
+        if (source == nullptr)
+            return *compiled;
+
+        compiled->exists = true;
+        compiled->source = *source;
+
+        if (source->isString())
+        {
+            const auto text = source->toString();
 
-        if (id.toString().containsIgnoreCase("width") || id.toString().containsIgnoreCase("x"))
-            return parentBounds.getWidth();
+            if (text.trim().equalsIgnoreCase("auto"))
+                return *compiled;
 
-        return parentBounds.getHeight();
+            compiled->unit = text.endsWith("%") ? Unit::percent : Unit::pixels;
+            compiled->value = text.getFloatValue();
+        }
+        else
+        {
+            compiled->unit = Unit::pixels;
+            compiled->value = static_cast<float>(*source);
+        }
+
+        return *compiled;
     }
 } // namespace jive
 
@@ -50,6 +115,8 @@ public:
     {
         testPixels();
         testPercent();
+        testAuto();
+        testAxis();
     }
 
 private:
@@ -99,7 +166,191 @@ private:
             expectWithinAbsoluteError(height.toPixels({ 40.0f, 20.0f }), 4.f, 0.000001f);
         }
     }
+
+    void testAuto()
+    {
+        beginTest("auto");
+
+        juce::ValueTree tree{ "Component" };
+        jive::Length width{ tree, "width" };
+        expect(width.isAuto());
+        expectEquals(width.toPixels({ 100.0f, 100.0f }), jive::Length::pixelValueWhenAuto);
+
+        tree.setProperty("width", " AUTO ", nullptr);
+        expect(width.isAuto());
+
+        tree.setProperty("width", 123, nullptr);
+        expect(!width.isAuto());
+        expect(width.isPixels());
+        expectEquals(width.toPixels({}), 123.0f);
+
+        tree.removeProperty("width", nullptr);
+        expect(width.isAuto());
+    }
+
+    void testAxis()
+    {
+        beginTest("axis");
+
+        juce::ValueTree tree{
+            "Component",
+            {
+                { "min-width", "10%" },
+                { "centre-x", "20%" },
+                { "min-height", "30%" },
+            },
+        };
+        juce::ValueTree parent{ "Parent" };
+        parent.appendChild(tree, nullptr);
+
+        const juce::Rectangle<float> parentBounds{ 200.0f, 100.0f };
+        expectEquals(jive::Length{ tree, "min-width" }.toPixels(parentBounds), 20.0f);
+        expectEquals(jive::Length{ tree, "centre-x" }.toPixels(parentBounds), 40.0f);
+        expectEquals(jive::Length{ tree, "min-height" }.toPixels(parentBounds), 30.0f);
+    }
 };
 
 static LengthUnitTest lengthUnitTest;
+
+class LengthBenchmark : public juce::UnitTest
+{
+public:
+    LengthBenchmark()
+        : juce::UnitTest{ "jive::Length", "jive-micro-benchmarks" }
+    {
+    }
+
+    void runTest() final
+    {
+        benchmarkReads();
+        benchmarkLayout();
+    }
+
+private:
+    static constexpr auto numItems = 10000;
+    static constexpr auto numPasses = 20;
+    static constexpr auto numReads = 1000000;
+
+    // Converts lengths the way they were before they were compiled, parsing
+    // the property on every read.
+    struct ParsedLength : public jive::Property<juce::String>
+    {
+        using jive::Property<juce::String>::Property;
+
+        float toPixels(const juce::Rectangle<float>& parentBounds) const
+        {
+            if (isAuto())
+                return jive::Length::pixelValueWhenAuto;
+
+            if (isPixels())
+                return get().getFloatValue();
+
+            const auto scale = static_cast<double>(get().getFloatValue()) * 0.01;
+            const auto relativeParentLength = id.toString().containsIgnoreCase("width") || id.toString().containsIgnoreCase("x")
+                                                ? static_cast<double>(parentBounds.getWidth())
+                                                : static_cast<double>(parentBounds.getHeight());
+            return static_cast<float>(scale * relativeParentLength);
+        }
+
+        bool isPixels() const
+        {
+            return !isAuto() && !isPercent();
+        }
+
+        bool isPercent() const
+        {
+            return !isAuto() && toString().endsWith("%");
+        }
+    };
+
+    template <typename LengthType>
+    double measureNanosecondsPerRead(const juce::ValueTree& tree)
+    {
+        const LengthType width{ tree, "width" };
+        const LengthType height{ tree, "height" };
+        const juce::Rectangle<float> parentBounds{ 400.0f, 300.0f };
+
+        auto total = 0.0;
+        const auto start = juce::Time::getHighResolutionTicks();
+
+        for (auto i = 0; i < numReads; i++)
+            total += static_cast<double>(width.toPixels(parentBounds) + height.toPixels(parentBounds));
+
+        const auto seconds = juce::Time::highResolutionTicksToSeconds(juce::Time::getHighResolutionTicks() - start);
+        expectEquals(total, numReads * 210.0);
+
+        return seconds * 1.0e9 / (numReads * 2);
+    }
+
+    void benchmarkReads()
+    {
+        beginTest("per-read cost");
+
+        juce::ValueTree parent{ "Component" };
+        juce::ValueTree tree{
+            "Component",
+            {
+                { "width", "50%" },
+                { "height", 10 },
+            },
+        };
+        parent.appendChild(tree, nullptr);
+
+        const auto parsingTime = measureNanosecondsPerRead<ParsedLength>(tree);
+        const auto compiledTime = measureNanosecondsPerRead<jive::Length>(tree);
+
+        logMessage(juce::String{ parsingTime, 1 } + "ns per read parsing on every read, "
+                   + juce::String{ compiledTime, 1 } + "ns per read when compiled ("
+                   + juce::String{ parsingTime / juce::jmax(compiledTime, 0.001), 1 } + "x)");
+    }
+
+    void benchmarkLayout()
+    {
+        beginTest("10k item flex column");
+
+        juce::ValueTree state{
+            "Component",
+            {
+                { "width", 400 },
+                { "height", 100000 },
+                { "flex-direction", "column" },
+            },
+        };
+
+        for (auto i = 0; i < numItems; i++)
+        {
+            state.appendChild(juce::ValueTree{
+                                  "Component",
+                                  {
+                                      { "width", "50%" },
+                                      { "height", 10 },
+                                      { "min-width", "10%" },
+                                      { "min-height", 5 },
+                                  },
+                              },
+                              nullptr);
+        }
+
+        jive::Interpreter interpreter;
+        std::unique_ptr<jive::GuiItem> item;
+
+        {
+            jive::StateTransaction transaction;
+            item = interpreter.interpret(state);
+        }
+
+        const auto start = juce::Time::getHighResolutionTicks();
+
+        for (auto pass = 0; pass < numPasses; pass++)
+            item->layOutChildren();
+
+        const auto seconds = juce::Time::highResolutionTicksToSeconds(juce::Time::getHighResolutionTicks() - start);
+        logMessage(juce::String{ seconds * 1000.0 / numPasses, 2 } + "ms per layout of "
+                   + juce::String{ numItems } + " items");
+
+        expectEquals(item->getChildren()[numItems - 1]->getComponent()->getWidth(), 200);
+    }
+};
+
+static LengthBenchmark lengthBenchmark;
 #endif
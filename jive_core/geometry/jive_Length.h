@@ -5,10 +5,12 @@ namespace jive
     class Length : public Property<juce::String>
     {
     public:
-        using Property<juce::String>::Property;
+        Length(juce::ValueTree sourceTree, const juce::Identifier& propertyID);
+        Length(juce::ValueTree sourceTree, const juce::Identifier& propertyID, const juce::String& initialValue);
 
         float toPixels(const juce::Rectangle<float>& parentBounds) const;
 
+        bool isAuto() const;
         bool isPixels() const;
         bool isPercent() const;
 
@@ -17,6 +19,31 @@ namespace jive
         static const float pixelValueWhenAuto;
 
     private:
-        double getRelativeParentLength(const juce::Rectangle<double>& parentBounds) const;
+        enum class Unit
+        {
+            automatic,
+            pixels,
+            percent,
+        };
+
+        enum class Axis
+        {
+            horizontal,
+            vertical,
+        };
+
+        struct Compiled
+        {
+            bool exists{ false };
+            juce::var source;
+            Unit unit{ Unit::automatic };
+            float value{ 0.0f };
+        };
+
+        static Axis getAxis(const juce::Identifier& propertyID);
+        const Compiled& compile() const;
+
+        const Axis axis;
+        mutable std::optional<Compiled> compiled;
     };
 } // namespace jive
@@ -2,22 +2,24 @@
 
 namespace juce
 {
-    const Array<var> VariantConverter<jive::Orientation>::options = {
-        "horizontal",
-        "vertical",
-    };
+    static constexpr auto orientationKeywords = jive::KeywordTable<jive::Orientation, 2>::sort({ {
+        { "horizontal", jive::Orientation::horizontal },
+        { "vertical", jive::Orientation::vertical },
+    } });
+
+    const jive::KeywordTable<jive::Orientation, 2> VariantConverter<jive::Orientation>::keywords{ orientationKeywords };
 
     jive::Orientation VariantConverter<jive::Orientation>::fromVar(const var& v)
     {
-        jassert(options.contains(v));
-        return static_cast<jive::Orientation>(options.indexOf(v));
+        if (const auto value = keywords.find(v))
+            return *value;
+
+        jassertfalse;
+        return jive::Orientation::horizontal;
     }
 
     var VariantConverter<jive::Orientation>::toVar(const jive::Orientation& orientation)
     {
-        const auto index = static_cast<int>(orientation);
-
-        jassert(options.size() >= index);
-        return options[index];
+        return keywords.toVar(orientation);
     }
 } // namespace juce
@@ -19,6 +19,6 @@ namespace juce
         static var toVar(const jive::Orientation& orientation);
 
     private:
-        static const Array<var> options;
+        static const jive::KeywordTable<jive::Orientation, 2> keywords;
     };
 } // namespace juce
@@ -97,28 +97,24 @@ namespace juce
         return stops;
     }
 
+    static constexpr auto gradientVariantKeywords = jive::KeywordTable<jive::Gradient::Variant, 2>::sort({ {
+        { "linear", jive::Gradient::Variant::linear },
+        { "radial", jive::Gradient::Variant::radial },
+    } });
+
+    const jive::KeywordTable<jive::Gradient::Variant, 2> VariantConverter<jive::Gradient::Variant>::keywords{ gradientVariantKeywords };
+
     var VariantConverter<jive::Gradient::Variant>::toVar(const jive::Gradient::Variant& variant)
     {
-        switch (variant)
-        {
-        case jive::Gradient::Variant::linear:
-            return "linear";
-        case jive::Gradient::Variant::radial:
-            return "radial";
-        }
-
-        jassertfalse;
-        return var{};
+        return keywords.toVar(variant);
     }
 
     jive::Gradient::Variant VariantConverter<jive::Gradient::Variant>::fromVar(const var& value)
     {
         jassert(value.isString());
 
-        if (value.toString() == "linear")
-            return jive::Gradient::Variant::linear;
-        if (value.toString() == "radial")
-            return jive::Gradient::Variant::radial;
+        if (const auto variant = keywords.find(value))
+            return *variant;
 
         jassertfalse;
         return {};
@@ -45,6 +45,9 @@ namespace juce
     {
         static var toVar(const jive::Gradient::Variant& variant);
         static jive::Gradient::Variant fromVar(const var& value);
+
+    private:
+        static const jive::KeywordTable<jive::Gradient::Variant, 2> keywords;
     };
 
     template <>
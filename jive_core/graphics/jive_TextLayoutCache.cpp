@@ -0,0 +1,335 @@
+#include <jive_core/jive_core.h>
+
+namespace jive
+{
+    // Describes everything about the text that affects its layout, so two
+    // strings have the same key if and only if they'd be laid out the same.
+    static juce::MemoryBlock createKey(const juce::AttributedString& text, float maxWidth)
+    {
+        juce::MemoryOutputStream stream;
+
+        stream.writeString(text.getText());
+        stream.writeInt(text.getJustification().getFlags());
+        stream.writeFloat(text.getLineSpacing());
+        stream.writeInt(static_cast<int>(text.getWordWrap()));
+        stream.writeInt(static_cast<int>(text.getReadingDirection()));
+        stream.writeFloat(maxWidth);
+
+        for (auto i = 0; i < text.getNumAttributes(); i++)
+        {
+            const auto& attribute = text.getAttribute(i);
+
+            stream.writeInt(attribute.range.getStart());
+            stream.writeInt(attribute.range.getEnd());
+            stream.writeString(attribute.font.getTypefaceName());
+            stream.writeString(attribute.font.getTypefaceStyle());
+            stream.writeFloat(attribute.font.getHeight());
+            stream.writeFloat(attribute.font.getExtraKerningFactor());
+            stream.writeFloat(attribute.font.getHorizontalScale());
+            stream.writeBool(attribute.font.isUnderlined());
+            stream.writeInt(static_cast<int>(attribute.colour.getARGB()));
+        }
+
+        return stream.getMemoryBlock();
+    }
+
+    static std::string_view toStringView(const juce::MemoryBlock& block)
+    {
+        return { static_cast<const char*>(block.getData()), block.getSize() };
+    }
+
+    static std::size_t estimateMemoryUsage(const juce::TextLayout& layout)
+    {
+        auto bytes = sizeof(juce::TextLayout);
+
+        for (const auto* line : layout)
+        {
+            bytes += sizeof(juce::TextLayout::Line);
+
+            for (const auto* run : line->runs)
+            {
+                bytes += sizeof(juce::TextLayout::Run)
+                         + static_cast<std::size_t>(run->glyphs.size()) * sizeof(juce::TextLayout::Glyph);
+            }
+        }
+
+        return bytes;
+    }
+
+    struct TextLayoutCache::Cache
+    {
+        struct Entry
+        {
+            juce::MemoryBlock key;
+            std::shared_ptr<const juce::TextLayout> layout;
+            std::size_t memoryUsage;
+        };
+
+        void moveToFront(std::list<Entry>::iterator entry)
+        {
+            entries.splice(std::begin(entries), entries, entry);
+        }
+
+        void evictUntilWithin(std::size_t maxBytes)
+        {
+            while (!entries.empty() && statistics.memoryUsage > maxBytes)
+            {
+                const auto& leastRecentlyUsed = entries.back();
+
+                statistics.memoryUsage -= leastRecentlyUsed.memoryUsage;
+                statistics.evictions++;
+                index.erase(toStringView(leastRecentlyUsed.key));
+                entries.pop_back();
+            }
+
+            statistics.numLayouts = static_cast<int>(entries.size());
+        }
+
+        juce::CriticalSection lock;
+
+        // Most recently used first. The index refers to the keys owned by the
+        // entries, which don't move as the list is reordered.
+        std::list<Entry> entries;
+        std::unordered_map<std::string_view, std::list<Entry>::iterator> index;
+
+        std::size_t maxMemoryUsage{ 4 * 1024 * 1024 };
+        Statistics statistics;
+    };
+
+    std::shared_ptr<const juce::TextLayout> TextLayoutCache::getLayout(const juce::AttributedString& text,
+                                                                        float maxWidth)
+    {
+        auto& cache = getCache();
+        auto key = createKey(text, maxWidth);
+
+        {
+            const juce::ScopedLock lock{ cache.lock };
+
+            if (const auto entry = cache.index.find(toStringView(key));
+                entry != std::end(cache.index))
+            {
+                cache.statistics.hits++;
+                cache.moveToFront(entry->second);
+
+                return entry->second->layout;
+            }
+
+            cache.statistics.misses++;
+        }
+
+        // Text is laid out outside of the lock so measuring on several
+        // threads at once isn't serialised.
+        auto layout = std::make_shared<juce::TextLayout>();
+        layout->createLayout(text, maxWidth);
+
+        const juce::ScopedLock lock{ cache.lock };
+
+        // Another thread may have laid out the same text in the meantime.
+        if (const auto entry = cache.index.find(toStringView(key));
+            entry != std::end(cache.index))
+        {
+            cache.moveToFront(entry->second);
+            return entry->second->layout;
+        }
+
+        const auto memoryUsage = estimateMemoryUsage(*layout) + key.getSize() + sizeof(Cache::Entry);
+        cache.entries.push_front({ std::move(key), layout, memoryUsage });
+        cache.index.emplace(toStringView(cache.entries.front().key), std::begin(cache.entries));
+        cache.statistics.memoryUsage += memoryUsage;
+
+        // The new layout is never evicted straight away, even if it's bigger
+        // than the limit by itself.
+        cache.evictUntilWithin(juce::jmax(cache.maxMemoryUsage, memoryUsage));
+
+        return layout;
+    }
+
+    void TextLayoutCache::resolveTypefaces(const juce::AttributedString& text)
+    {
+        JUCE_ASSERT_MESSAGE_THREAD
+
+        for (auto i = 0; i < text.getNumAttributes(); i++)
+            text.getAttribute(i).font.getTypefacePtr();
+    }
+
+    void TextLayoutCache::setMaxMemoryUsage(std::size_t maxBytes)
+    {
+        auto& cache = getCache();
+        const juce::ScopedLock lock{ cache.lock };
+
+        cache.maxMemoryUsage = maxBytes;
+        cache.evictUntilWithin(maxBytes);
+    }
+
+    std::size_t TextLayoutCache::getMaxMemoryUsage()
+    {
+        auto& cache = getCache();
+        const juce::ScopedLock lock{ cache.lock };
+
+        return cache.maxMemoryUsage;
+    }
+
+    TextLayoutCache::Statistics TextLayoutCache::getStatistics()
+    {
+        auto& cache = getCache();
+        const juce::ScopedLock lock{ cache.lock };
+
+        return cache.statistics;
+    }
+
+    void TextLayoutCache::resetStatistics()
+    {
+        auto& cache = getCache();
+        const juce::ScopedLock lock{ cache.lock };
+
+        cache.statistics.hits = 0;
+        cache.statistics.misses = 0;
+        cache.statistics.evictions = 0;
+    }
+
+    void TextLayoutCache::clear()
+    {
+        auto& cache = getCache();
+        const juce::ScopedLock lock{ cache.lock };
+
+        cache.index.clear();
+        cache.entries.clear();
+        cache.statistics = Statistics{};
+    }
+
+    TextLayoutCache::Cache& TextLayoutCache::getCache()
+    {
+        static Cache cache;
+        return cache;
+    }
+
+    float TextLayoutCache::Statistics::getHitRate() const noexcept
+    {
+        const auto total = hits + misses;
+
+        if (total == 0)
+            return 0.0f;
+
+        return static_cast<float>(hits) / static_cast<float>(total);
+    }
+} // namespace jive
+
+#if JIVE_UNIT_TESTS
+class TextLayoutCacheUnitTest : public juce::UnitTest
+{
+public:
+    TextLayoutCacheUnitTest()
+        : juce::UnitTest{ "jive::TextLayoutCache", "jive" }
+    {
+    }
+
+    void runTest() final
+    {
+        testSharedLayouts();
+        testKeys();
+        testEviction();
+    }
+
+private:
+    static juce::AttributedString createText(const juce::String& content)
+    {
+        juce::AttributedString text;
+        text.append(content, juce::Font{ 15.0f }, juce::Colours::black);
+        return text;
+    }
+
+    void testSharedLayouts()
+    {
+        beginTest("shared layouts");
+
+        jive::TextLayoutCache::clear();
+
+        const auto first = jive::TextLayoutCache::getLayout(createText("Gain"), 100.0f);
+        const auto second = jive::TextLayoutCache::getLayout(createText("Gain"), 100.0f);
+        expect(first == second);
+
+        juce::TextLayout expected;
+        expected.createLayout(createText("Gain"), 100.0f);
+        expectEquals(first->getWidth(), expected.getWidth());
+        expectEquals(first->getHeight(), expected.getHeight());
+
+        const auto statistics = jive::TextLayoutCache::getStatistics();
+        expectEquals(statistics.hits, 1);
+        expectEquals(statistics.misses, 1);
+        expectEquals(statistics.numLayouts, 1);
+        expectEquals(statistics.getHitRate(), 0.5f);
+        expectGreaterThan(statistics.memoryUsage, std::size_t{ 0 });
+
+        jive::TextLayoutCache::resetStatistics();
+        expectEquals(jive::TextLayoutCache::getStatistics().hits, 0);
+        expectEquals(jive::TextLayoutCache::getStatistics().numLayouts, 1);
+    }
+
+    void testKeys()
+    {
+        beginTest("keys");
+
+        jive::TextLayoutCache::clear();
+
+        const auto layout = jive::TextLayoutCache::getLayout(createText("Gain"), 100.0f);
+        expect(jive::TextLayoutCache::getLayout(createText("Gain"), 50.0f) != layout);
+        expect(jive::TextLayoutCache::getLayout(createText("Pan"), 100.0f) != layout);
+
+        auto bigger = createText("Gain");
+        bigger.setFont(juce::Font{ 30.0f });
+        expect(jive::TextLayoutCache::getLayout(bigger, 100.0f) != layout);
+
+        auto wrapped = createText("Gain");
+        wrapped.setWordWrap(juce::AttributedString::WordWrap::none);
+        expect(jive::TextLayoutCache::getLayout(wrapped, 100.0f) != layout);
+
+        auto spaced = createText("Gain");
+        spaced.setLineSpacing(4.0f);
+        expect(jive::TextLayoutCache::getLayout(spaced, 100.0f) != layout);
+
+        auto rightToLeft = createText("Gain");
+        rightToLeft.setReadingDirection(juce::AttributedString::ReadingDirection::rightToLeft);
+        expect(jive::TextLayoutCache::getLayout(rightToLeft, 100.0f) != layout);
+
+        expectEquals(jive::TextLayoutCache::getStatistics().hits, 0);
+        expectEquals(jive::TextLayoutCache::getStatistics().numLayouts, 7);
+    }
+
+    void testEviction()
+    {
+        beginTest("eviction");
+
+        jive::TextLayoutCache::clear();
+        const auto maxMemoryUsage = jive::TextLayoutCache::getMaxMemoryUsage();
+
+        const auto first = jive::TextLayoutCache::getLayout(createText("First"), 100.0f);
+        const auto memoryPerLayout = jive::TextLayoutCache::getStatistics().memoryUsage;
+        jive::TextLayoutCache::setMaxMemoryUsage(memoryPerLayout * 2);
+
+        jive::TextLayoutCache::getLayout(createText("Other"), 100.0f);
+        jive::TextLayoutCache::getLayout(createText("First"), 100.0f);
+        jive::TextLayoutCache::getLayout(createText("Third"), 100.0f);
+
+        auto statistics = jive::TextLayoutCache::getStatistics();
+        expectEquals(statistics.evictions, 1);
+        expectEquals(statistics.numLayouts, 2);
+        expectLessOrEqual(statistics.memoryUsage, memoryPerLayout * 2);
+
+        // "Other" was the least recently used, so was evicted instead of
+        // "First".
+        expect(jive::TextLayoutCache::getLayout(createText("First"), 100.0f) == first);
+
+        // Evicted layouts stay alive for as long as they're still in use.
+        jive::TextLayoutCache::setMaxMemoryUsage(0);
+        statistics = jive::TextLayoutCache::getStatistics();
+        expectEquals(statistics.numLayouts, 0);
+        expectEquals(statistics.memoryUsage, std::size_t{ 0 });
+        expectEquals(first->getNumLines(), 1);
+
+        jive::TextLayoutCache::setMaxMemoryUsage(maxMemoryUsage);
+        jive::TextLayoutCache::clear();
+    }
+};
+
+static TextLayoutCacheUnitTest textLayoutCacheUnitTest;
+#endif
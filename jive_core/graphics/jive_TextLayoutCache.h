@@ -0,0 +1,47 @@
+#pragma once
+
+namespace jive
+{
+    // A least-recently-used cache of text layouts, shared by every item, so
+    // identical text (e.g. the same label repeated in a list) is only shaped
+    // once at each width. Safe to use from any thread.
+    class TextLayoutCache
+    {
+    public:
+        struct Statistics
+        {
+            float getHitRate() const noexcept;
+
+            int hits{ 0 };
+            int misses{ 0 };
+            int evictions{ 0 };
+            int numLayouts{ 0 };
+
+            // An estimate of the memory used by the cached layouts and their
+            // keys, in bytes.
+            std::size_t memoryUsage{ 0 };
+        };
+
+        static std::shared_ptr<const juce::TextLayout> getLayout(const juce::AttributedString& text, float maxWidth);
+
+        // Finding a font's typeface for the first time goes through the
+        // default LookAndFeel, which mustn't be touched off the message
+        // thread. Call this on the message thread for any text that'll be
+        // laid out on another thread, so each font already knows its
+        // typeface. Copies of the text share the fonts' typefaces.
+        static void resolveTypefaces(const juce::AttributedString& text);
+
+        // The least recently used layouts are evicted once the estimated
+        // memory usage exceeds this many bytes.
+        static void setMaxMemoryUsage(std::size_t maxBytes);
+        static std::size_t getMaxMemoryUsage();
+
+        static Statistics getStatistics();
+        static void resetStatistics();
+        static void clear();
+
+    private:
+        struct Cache;
+        static Cache& getCache();
+    };
+} // namespace jive
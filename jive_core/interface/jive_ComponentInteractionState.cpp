@@ -69,44 +69,46 @@ namespace jive
 
 namespace juce
 {
-    const std::unordered_map<jive::ComponentInteractionState::Mouse, juce::String> VariantConverter<jive::ComponentInteractionState::Mouse>::map{
-        { jive::ComponentInteractionState::Mouse::dissociate, "dissociate" },
-        { jive::ComponentInteractionState::Mouse::hover, "hover" },
-        { jive::ComponentInteractionState::Mouse::active, "active" },
-    };
+    static constexpr auto componentInteractionStateMouseKeywords = jive::KeywordTable<jive::ComponentInteractionState::Mouse, 3>::sort({ {
+        { "dissociate", jive::ComponentInteractionState::Mouse::dissociate },
+        { "hover", jive::ComponentInteractionState::Mouse::hover },
+        { "active", jive::ComponentInteractionState::Mouse::active },
+    } });
+
+    const jive::KeywordTable<jive::ComponentInteractionState::Mouse, 3> VariantConverter<jive::ComponentInteractionState::Mouse>::keywords{ componentInteractionStateMouseKeywords };
 
     var VariantConverter<jive::ComponentInteractionState::Mouse>::toVar(const jive::ComponentInteractionState::Mouse& mouse)
     {
-        return map.find(mouse)->second;
+        return keywords.toVar(mouse);
     }
 
     jive::ComponentInteractionState::Mouse VariantConverter<jive::ComponentInteractionState::Mouse>::fromVar(const var& value)
     {
-        return std::find_if(std::begin(map),
-                            std::end(map),
-                            [value](auto&& pair) {
-                                return value.toString() == pair.second;
-                            })
-            ->first;
+        if (const auto mouse = keywords.find(value))
+            return *mouse;
+
+        jassertfalse;
+        return jive::ComponentInteractionState::Mouse::dissociate;
     }
 
-    var VariantConverter<jive::ComponentInteractionState::Keyboard>::toVar(const jive::ComponentInteractionState::Keyboard& mouse)
+    static constexpr auto componentInteractionStateKeyboardKeywords = jive::KeywordTable<jive::ComponentInteractionState::Keyboard, 2>::sort({ {
+        { "dissociate", jive::ComponentInteractionState::Keyboard::dissociate },
+        { "focus", jive::ComponentInteractionState::Keyboard::focus },
+    } });
+
+    const jive::KeywordTable<jive::ComponentInteractionState::Keyboard, 2> VariantConverter<jive::ComponentInteractionState::Keyboard>::keywords{ componentInteractionStateKeyboardKeywords };
+
+    var VariantConverter<jive::ComponentInteractionState::Keyboard>::toVar(const jive::ComponentInteractionState::Keyboard& keyboard)
     {
-        return map.find(mouse)->second;
+        return keywords.toVar(keyboard);
     }
 
     jive::ComponentInteractionState::Keyboard VariantConverter<jive::ComponentInteractionState::Keyboard>::fromVar(const var& value)
     {
-        return std::find_if(std::begin(map),
-                            std::end(map),
-                            [value](auto&& pair) {
-                                return value.toString() == pair.second;
-                            })
-            ->first;
-    }
+        if (const auto keyboard = keywords.find(value))
+            return *keyboard;
 
-    const std::unordered_map<jive::ComponentInteractionState::Keyboard, juce::String> VariantConverter<jive::ComponentInteractionState::Keyboard>::map{
-        { jive::ComponentInteractionState::Keyboard::dissociate, "dissociate" },
-        { jive::ComponentInteractionState::Keyboard::focus, "focus" },
-    };
+        jassertfalse;
+        return jive::ComponentInteractionState::Keyboard::dissociate;
+    }
 } // namespace juce
\ No newline at end of file
@@ -49,7 +49,7 @@ namespace juce
         static jive::ComponentInteractionState::Mouse fromVar(const var&);
 
     private:
-        static const std::unordered_map<jive::ComponentInteractionState::Mouse, juce::String> map;
+        static const jive::KeywordTable<jive::ComponentInteractionState::Mouse, 3> keywords;
     };
     template <>
     class VariantConverter<jive::ComponentInteractionState::Keyboard>
@@ -59,6 +59,6 @@ namespace juce
         static jive::ComponentInteractionState::Keyboard fromVar(const var&);
 
     private:
-        static const std::unordered_map<jive::ComponentInteractionState::Keyboard, juce::String> map;
+        static const jive::KeywordTable<jive::ComponentInteractionState::Keyboard, 2> keywords;
     };
 } // namespace juce
\ No newline at end of file
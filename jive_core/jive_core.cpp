@@ -1,19 +1,26 @@
 #include "jive_core.h"
 
+#include "logging/jive_LayoutStats.cpp"
 #include "logging/jive_StringStreams.cpp"
 
 #include "algorithms/jive_Find.cpp"
 
 #include "values/jive_Event.cpp"
 #include "values/jive_Object.cpp"
+#include "values/jive_ObjectCache.cpp"
 #include "values/jive_Property.cpp"
+#include "values/jive_PropertyDispatcher.cpp"
+#include "values/jive_StateTransaction.cpp"
 #include "values/jive_XmlParser.cpp"
+#include "values/variant-converters/jive_KeywordTable.cpp"
 #include "values/variant-converters/jive_AttributedStringVariantConverters.cpp"
 #include "values/variant-converters/jive_FlexVariantConverters.cpp"
 #include "values/variant-converters/jive_GridVariantConverters.cpp"
 #include "values/variant-converters/jive_MiscVariantConverters.cpp"
 
 #include "geometry/jive_BoxModel.cpp"
+#include "geometry/jive_BoxModelView.cpp"
+#include "geometry/jive_LayoutNodeStore.cpp"
 #include "geometry/jive_Length.cpp"
 #include "geometry/jive_Orientation.cpp"
 
@@ -21,5 +28,6 @@
 #include "graphics/jive_FontUtilities.cpp"
 #include "graphics/jive_Gradient.cpp"
 #include "graphics/jive_LookAndFeel.cpp"
+#include "graphics/jive_TextLayoutCache.cpp"
 
 #include "interface/jive_ComponentInteractionState.cpp"
@@ -12,16 +12,36 @@ END_JUCE_MODULE_DECLARATION */
 
 #define JIVE_CORE_H_INCLUDED
 
+/** Config: JIVE_LAYOUT_STATS
+    Enables jive::LayoutStats, which counts and times the calls made while
+    laying out items. Disabled by default as it adds overhead to every layout.
+*/
+#ifndef JIVE_LAYOUT_STATS
+    #define JIVE_LAYOUT_STATS 0
+#endif
+
 #include <juce_gui_basics/juce_gui_basics.h>
 
+#include <list>
+#include <numeric>
+#include <string_view>
+#include <unordered_set>
+
 #include "logging/jive_StringStreams.h"
+#include "logging/jive_LayoutStats.h"
 
 #include "algorithms/jive_Find.h"
 
+#include "values/jive_IdentifierHash.h"
+
 #include "values/jive_Event.h"
 #include "values/jive_Object.h"
+#include "values/jive_ObjectCache.h"
+#include "values/jive_PropertyDispatcher.h"
 #include "values/jive_Property.h"
+#include "values/jive_StateTransaction.h"
 #include "values/jive_XmlParser.h"
+#include "values/variant-converters/jive_KeywordTable.h"
 #include "values/variant-converters/jive_AttributedStringVariantConverters.h"
 #include "values/variant-converters/jive_FlexVariantConverters.h"
 #include "values/variant-converters/jive_GridVariantConverters.h"
@@ -31,11 +51,14 @@ END_JUCE_MODULE_DECLARATION */
 #include "geometry/jive_Length.h"
 #include "geometry/jive_Orientation.h"
 
+#include "geometry/jive_LayoutNodeStore.h"
 #include "geometry/jive_BoxModel.h"
+#include "geometry/jive_BoxModelView.h"
 
 #include "graphics/jive_FontUtilities.h"
 #include "graphics/jive_Gradient.h"
 #include "graphics/jive_LookAndFeel.h"
+#include "graphics/jive_TextLayoutCache.h"
 
 #include "graphics/jive_Fill.h"
 
@@ -0,0 +1,422 @@
+#include <jive_core/jive_core.h>
+
+#if JIVE_LAYOUT_STATS
+namespace jive
+{
+    LayoutStats::ScopedCall::ScopedCall(Counter callCounter, const juce::ValueTree& itemState)
+        : counter{ callCounter }
+        , item{ itemState }
+        , startTicks{ juce::Time::getHighResolutionTicks() }
+        , isRecording{ isEnabled() && juce::MessageManager::existsAndIsCurrentThread() }
+    {
+        if (!isRecording)
+            return;
+
+        auto& stats = getInstance();
+        const auto index = static_cast<std::size_t>(counter);
+
+        auto& itemStatistics = stats.getItemStatistics(item);
+        itemStatistics.statistics.calls[index]++;
+        isOutermostForItem = itemStatistics.depths[index]++ == 0;
+
+        stats.totals.calls[index]++;
+        isOutermostOverall = stats.totalDepths[index]++ == 0;
+
+        if (counter == Counter::layOutChildren)
+            stats.maxLayoutDepth = juce::jmax(stats.maxLayoutDepth, ++stats.layoutDepth);
+    }
+
+    LayoutStats::ScopedCall::~ScopedCall()
+    {
+        if (!isRecording)
+            return;
+
+        const auto seconds = juce::Time::highResolutionTicksToSeconds(juce::Time::getHighResolutionTicks() - startTicks);
+        auto& stats = getInstance();
+        const auto index = static_cast<std::size_t>(counter);
+
+        // The statistics may have been reset since this call started.
+        if (const auto itemStatistics = stats.items.find(&item.getProperties());
+            itemStatistics != std::end(stats.items))
+        {
+            auto& depth = itemStatistics->second.depths[index];
+            depth = juce::jmax(0, depth - 1);
+
+            if (isOutermostForItem)
+                itemStatistics->second.statistics.seconds[index] += seconds;
+        }
+
+        stats.totalDepths[index] = juce::jmax(0, stats.totalDepths[index] - 1);
+
+        if (isOutermostOverall)
+            stats.totals.seconds[index] += seconds;
+
+        if (counter == Counter::layOutChildren)
+            stats.layoutDepth = juce::jmax(0, stats.layoutDepth - 1);
+    }
+
+    LayoutStats::Statistics LayoutStats::getTotals()
+    {
+        return getInstance().totals;
+    }
+
+    LayoutStats::Statistics LayoutStats::getStatistics(const juce::ValueTree& item)
+    {
+        const auto& items = getInstance().items;
+
+        if (const auto itemStatistics = items.find(&item.getProperties());
+            itemStatistics != std::end(items))
+        {
+            return itemStatistics->second.statistics;
+        }
+
+        return {};
+    }
+
+    int LayoutStats::getMaxLayoutDepth()
+    {
+        return getInstance().maxLayoutDepth;
+    }
+
+    void LayoutStats::reset()
+    {
+        auto& stats = getInstance();
+
+        stats.totals = {};
+        stats.totalDepths = {};
+        stats.items.clear();
+        stats.numItemsAfterRemoval = 0;
+        stats.maxLayoutDepth = stats.layoutDepth;
+    }
+
+    void LayoutStats::setEnabled(bool shouldBeEnabled)
+    {
+        getInstance().enabled = shouldBeEnabled;
+    }
+
+    bool LayoutStats::isEnabled()
+    {
+        return getInstance().enabled;
+    }
+
+    int LayoutStats::getNumItems()
+    {
+        return static_cast<int>(getInstance().items.size());
+    }
+
+    LayoutStats::ItemStatistics& LayoutStats::getItemStatistics(const juce::ValueTree& item)
+    {
+        static constexpr std::size_t minNumItemsBeforeRemoval = 64;
+
+        auto [itemStatistics, isNew] = items.try_emplace(&item.getProperties());
+
+        if (isNew)
+        {
+            itemStatistics->second.item = item;
+
+            // The given item is referenced by the caller, so won't be removed.
+            if (items.size() >= 2 * juce::jmax(numItemsAfterRemoval, minNumItemsBeforeRemoval))
+                removeDeletedItems();
+        }
+
+        return itemStatistics->second;
+    }
+
+    void LayoutStats::removeDeletedItems()
+    {
+        // Removing a parent can leave its children referenced only by these
+        // statistics, so keep going until nothing else is removed.
+        for (auto numItemsBefore = items.size() + 1; items.size() < numItemsBefore;)
+        {
+            numItemsBefore = items.size();
+
+            for (auto entry = std::begin(items); entry != std::end(items);)
+            {
+                if (entry->second.item.getReferenceCount() <= 1)
+                    entry = items.erase(entry);
+                else
+                    ++entry;
+            }
+        }
+
+        numItemsAfterRemoval = items.size();
+    }
+
+    static juce::int64 getTotalCalls(const LayoutStats::Statistics& statistics)
+    {
+        return std::accumulate(std::begin(statistics.calls), std::end(statistics.calls), juce::int64{ 0 });
+    }
+
+    static juce::String describe(const LayoutStats::Statistics& statistics)
+    {
+        juce::StringArray counts;
+
+        for (std::size_t i = 0; i < LayoutStats::numCounters; i++)
+        {
+            if (statistics.calls[i] == 0)
+                continue;
+
+            counts.add(LayoutStats::getName(static_cast<LayoutStats::Counter>(i))
+                       + ": "
+                       + juce::String{ statistics.calls[i] }
+                       + " ("
+                       + juce::String{ statistics.seconds[i] * 1000.0, 3 }
+                       + "ms)");
+        }
+
+        return counts.joinIntoString(", ");
+    }
+
+    static juce::String describe(const juce::ValueTree& item)
+    {
+        if (item.hasProperty("id"))
+            return item.getType().toString() + "#" + item["id"].toString();
+
+        return item.getType().toString();
+    }
+
+    juce::String LayoutStats::dump(int maxItems)
+    {
+        const auto& stats = getInstance();
+
+        std::vector<const ItemStatistics*> offenders;
+        offenders.reserve(stats.items.size());
+
+        for (const auto& itemStatistics : stats.items)
+            offenders.push_back(&itemStatistics.second);
+
+        std::sort(std::begin(offenders),
+                  std::end(offenders),
+                  [](const ItemStatistics* a, const ItemStatistics* b) {
+                      return getTotalCalls(a->statistics) > getTotalCalls(b->statistics);
+                  });
+        offenders.resize(juce::jmin(offenders.size(), static_cast<std::size_t>(juce::jmax(0, maxItems))));
+
+        // The offenders are shown within their ancestors, so it's clear where
+        // in the tree they are.
+        std::unordered_set<const juce::NamedValueSet*> shownItems;
+        std::vector<juce::ValueTree> roots;
+
+        for (const auto* offender : offenders)
+        {
+            for (auto item = offender->item; item.isValid(); item = item.getParent())
+            {
+                if (!shownItems.insert(&item.getProperties()).second)
+                    break;
+
+                if (!item.getParent().isValid())
+                    roots.push_back(item);
+            }
+        }
+
+        juce::String text;
+        text << "Layout stats - " << describe(stats.totals)
+             << ", max layout depth: " << stats.maxLayoutDepth << "\n";
+
+        std::function<void(const juce::ValueTree&, int)> appendItem = [&](const juce::ValueTree& item, int depth) {
+            text << juce::String::repeatedString("  ", depth) << describe(item);
+
+            if (const auto itemStatistics = stats.items.find(&item.getProperties());
+                itemStatistics != std::end(stats.items))
+            {
+                text << " - " << describe(itemStatistics->second.statistics);
+            }
+
+            text << "\n";
+
+            for (const auto& child : item)
+            {
+                if (shownItems.count(&child.getProperties()) > 0)
+                    appendItem(child, depth + 1);
+            }
+        };
+
+        for (const auto& root : roots)
+            appendItem(root, 1);
+
+        return text;
+    }
+
+    juce::String LayoutStats::getName(Counter counter)
+    {
+        switch (counter)
+        {
+        case Counter::layOutChildren:
+            return "layOutChildren";
+        case Counter::calculateIdealSize:
+            return "calculateIdealSize";
+        case Counter::toJuceFlexItem:
+            return "toJuceFlexItem";
+        case Counter::buildTextLayout:
+            return "buildTextLayout";
+        case Counter::boxModelRecalculation:
+            return "boxModelRecalculation";
+        }
+
+        jassertfalse;
+        return {};
+    }
+
+    LayoutStats& LayoutStats::getInstance()
+    {
+        static LayoutStats stats;
+        return stats;
+    }
+} // namespace jive
+
+    #if JIVE_UNIT_TESTS
+class LayoutStatsUnitTest : public juce::UnitTest
+{
+public:
+    LayoutStatsUnitTest()
+        : juce::UnitTest{ "jive::LayoutStats", "jive" }
+    {
+    }
+
+    void runTest() final
+    {
+        testScopes();
+        testNestedScopes();
+        testDeletedItems();
+        testDump();
+    }
+
+private:
+    void testScopes()
+    {
+        beginTest("scopes");
+
+        jive::LayoutStats::reset();
+        const juce::ValueTree item{ "Component" };
+
+        for (auto i = 0; i < 3; i++)
+        {
+            JIVE_LAYOUT_STATS_SCOPE(toJuceFlexItem, item);
+        }
+
+        const auto statistics = jive::LayoutStats::getStatistics(item);
+        expectEquals(statistics.calls[static_cast<std::size_t>(jive::LayoutStats::Counter::toJuceFlexItem)], juce::int64{ 3 });
+        expectEquals(statistics.calls[static_cast<std::size_t>(jive::LayoutStats::Counter::layOutChildren)], juce::int64{ 0 });
+        expectEquals(jive::LayoutStats::getTotals().calls[static_cast<std::size_t>(jive::LayoutStats::Counter::toJuceFlexItem)],
+                     juce::int64{ 3 });
+        expectEquals(jive::LayoutStats::getStatistics(juce::ValueTree{ "Component" }).calls[0], juce::int64{ 0 });
+
+        jive::LayoutStats::reset();
+        expectEquals(jive::LayoutStats::getStatistics(item).calls[static_cast<std::size_t>(jive::LayoutStats::Counter::toJuceFlexItem)],
+                     juce::int64{ 0 });
+    }
+
+    void testNestedScopes()
+    {
+        beginTest("nested scopes");
+
+        jive::LayoutStats::reset();
+        const juce::ValueTree parent{ "Component" };
+        const juce::ValueTree child{ "Component" };
+
+        {
+            JIVE_LAYOUT_STATS_SCOPE(layOutChildren, parent);
+
+            {
+                JIVE_LAYOUT_STATS_SCOPE(layOutChildren, child);
+
+                {
+                    JIVE_LAYOUT_STATS_SCOPE(layOutChildren, parent);
+                }
+            }
+        }
+
+        expectEquals(jive::LayoutStats::getMaxLayoutDepth(), 3);
+        expectEquals(jive::LayoutStats::getStatistics(parent).calls[0], juce::int64{ 2 });
+        expectEquals(jive::LayoutStats::getTotals().calls[0], juce::int64{ 3 });
+        expectGreaterOrEqual(jive::LayoutStats::getTotals().seconds[0], jive::LayoutStats::getStatistics(child).seconds[0]);
+
+        jive::LayoutStats::reset();
+        expectEquals(jive::LayoutStats::getMaxLayoutDepth(), 0);
+    }
+
+    void testDeletedItems()
+    {
+        beginTest("deleted items");
+
+        jive::LayoutStats::reset();
+        const juce::ValueTree item{ "Component" };
+
+        {
+            JIVE_LAYOUT_STATS_SCOPE(layOutChildren, item);
+        }
+
+        for (auto i = 0; i < 1000; i++)
+        {
+            const juce::ValueTree deletedItem{ "Component" };
+            JIVE_LAYOUT_STATS_SCOPE(layOutChildren, deletedItem);
+        }
+
+        expectLessThan(jive::LayoutStats::getNumItems(), 200);
+        expectEquals(jive::LayoutStats::getStatistics(item).calls[0], juce::int64{ 1 });
+
+        jive::LayoutStats::setEnabled(false);
+
+        {
+            JIVE_LAYOUT_STATS_SCOPE(layOutChildren, item);
+        }
+
+        jive::LayoutStats::setEnabled(true);
+        expectEquals(jive::LayoutStats::getStatistics(item).calls[0], juce::int64{ 1 });
+
+        jive::LayoutStats::reset();
+    }
+
+    void testDump()
+    {
+        beginTest("dump");
+
+        jive::LayoutStats::reset();
+
+        juce::ValueTree state{
+            "Component",
+            {
+                { "id", "root" },
+                { "width", 200 },
+                { "height", 200 },
+            },
+            {
+                juce::ValueTree{
+                    "Component",
+                    {
+                        { "id", "panel" },
+                    },
+                    {
+                        juce::ValueTree{ "Text", { { "id", "label" }, { "text", "Hello" } } },
+                    },
+                },
+                juce::ValueTree{ "Component", { { "id", "quiet" } } },
+            },
+        };
+        jive::Interpreter interpreter;
+        auto item = interpreter.interpret(state);
+
+        expectGreaterThan(jive::LayoutStats::getTotals().calls[static_cast<std::size_t>(jive::LayoutStats::Counter::layOutChildren)],
+                          juce::int64{ 0 });
+        expectGreaterThan(jive::LayoutStats::getTotals().calls[static_cast<std::size_t>(jive::LayoutStats::Counter::toJuceFlexItem)],
+                          juce::int64{ 0 });
+        expectGreaterThan(jive::LayoutStats::getTotals().calls[static_cast<std::size_t>(jive::LayoutStats::Counter::buildTextLayout)],
+                          juce::int64{ 0 });
+        expectGreaterThan(jive::LayoutStats::getStatistics(state).calls[static_cast<std::size_t>(jive::LayoutStats::Counter::layOutChildren)],
+                          juce::int64{ 0 });
+
+        const auto callsBefore = jive::LayoutStats::getTotals().calls[static_cast<std::size_t>(jive::LayoutStats::Counter::boxModelRecalculation)];
+        state.getChild(1).setProperty("width", 50, nullptr);
+        expectGreaterThan(jive::LayoutStats::getTotals().calls[static_cast<std::size_t>(jive::LayoutStats::Counter::boxModelRecalculation)],
+                          callsBefore);
+
+        const auto dump = jive::LayoutStats::dump(1);
+        expect(dump.contains("max layout depth"));
+        expect(dump.contains("Component#root"));
+        expect(!jive::LayoutStats::dump(0).contains("Component#root"));
+    }
+};
+
+static LayoutStatsUnitTest layoutStatsUnitTest;
+    #endif
+#endif
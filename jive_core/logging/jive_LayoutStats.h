@@ -0,0 +1,104 @@
+#pragma once
+
+#if JIVE_LAYOUT_STATS
+namespace jive
+{
+    // Counts and times the expensive parts of laying out items, both in total
+    // and per item, to help find out why a change is slow. Only available
+    // when JIVE_LAYOUT_STATS is enabled, otherwise the scopes that record the
+    // statistics compile to nothing. Only calls made on the message thread
+    // are recorded.
+    class LayoutStats
+    {
+    public:
+        enum class Counter
+        {
+            layOutChildren,
+            calculateIdealSize,
+            toJuceFlexItem,
+            buildTextLayout,
+            boxModelRecalculation,
+        };
+
+        static constexpr auto numCounters = static_cast<std::size_t>(Counter::boxModelRecalculation) + 1;
+
+        struct Statistics
+        {
+            std::array<juce::int64, numCounters> calls{};
+
+            // Calls nested within another call of the same counter for the
+            // same item aren't timed again, so time isn't counted twice.
+            std::array<double, numCounters> seconds{};
+        };
+
+        // Records a call, and the time spent in it, for the lifetime of the
+        // scope.
+        class ScopedCall
+        {
+        public:
+            ScopedCall(Counter counter, const juce::ValueTree& item);
+            ~ScopedCall();
+
+        private:
+            const Counter counter;
+            const juce::ValueTree item;
+            const juce::int64 startTicks;
+            const bool isRecording;
+            bool isOutermostForItem{ false };
+            bool isOutermostOverall{ false };
+
+            JUCE_DECLARE_NON_COPYABLE(ScopedCall)
+        };
+
+        static Statistics getTotals();
+        static Statistics getStatistics(const juce::ValueTree& item);
+
+        // The most layouts that were in progress at once, e.g. from an item
+        // being laid out as a result of its parent resizing it.
+        static int getMaxLayoutDepth();
+
+        static void reset();
+
+        // Statistics are recorded while enabled, as they are by default.
+        // Disabling them keeps their cost out of any timings being taken.
+        static void setEnabled(bool shouldBeEnabled);
+        static bool isEnabled();
+
+        // The number of items with statistics. Items whose trees have been
+        // deleted are dropped as more items are recorded.
+        static int getNumItems();
+
+        // Describes the items with the most calls, along with their
+        // ancestors, as an indented tree.
+        static juce::String dump(int maxItems = 10);
+
+        static juce::String getName(Counter counter);
+
+    private:
+        struct ItemStatistics
+        {
+            juce::ValueTree item;
+            Statistics statistics;
+            std::array<int, numCounters> depths{};
+        };
+
+        static LayoutStats& getInstance();
+
+        ItemStatistics& getItemStatistics(const juce::ValueTree& item);
+        void removeDeletedItems();
+
+        Statistics totals;
+        std::array<int, numCounters> totalDepths{};
+        std::unordered_map<const juce::NamedValueSet*, ItemStatistics> items;
+        std::size_t numItemsAfterRemoval{ 0 };
+        int layoutDepth{ 0 };
+        int maxLayoutDepth{ 0 };
+        bool enabled{ true };
+    };
+} // namespace jive
+
+    #define JIVE_LAYOUT_STATS_SCOPE(counter, item) \
+        const jive::LayoutStats::ScopedCall JUCE_JOIN_MACRO(layoutStatsScope_, __LINE__) { jive::LayoutStats::Counter::counter, item }
+#else
+    #define JIVE_LAYOUT_STATS_SCOPE(counter, item)
+#endif
@@ -0,0 +1,16 @@
+#pragma once
+
+namespace std
+{
+    template <>
+    class hash<juce::Identifier>
+    {
+    public:
+        std::size_t operator()(const juce::Identifier& id) const
+        {
+            // Identifiers are pooled, so two identifiers are equal if and only
+            // if they share the same underlying string.
+            return std::hash<const void*>{}(id.getCharPointer().getAddress());
+        }
+    };
+} // namespace std
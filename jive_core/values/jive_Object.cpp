@@ -8,46 +8,73 @@ namespace jive
         explicit InternalListener(Object& obj)
             : object{ obj }
         {
-            for (const auto& nested : findNestedObjects())
-                nested->addListener(*this);
+            for (const auto& [name, value] : object.getProperties())
+                updateNestedObject(name, value);
+        }
 
-            object.addListener(*this);
+        ~InternalListener() override
+        {
+            for (const auto& [nested, numProperties] : attachments)
+                nested->removeListener(*this);
         }
 
         void propertyChanged(Object& objectThatChanged,
                              const juce::Identifier& propertyName) final
         {
-            if (&objectThatChanged == &object)
+            object.listeners.call(&Listener::propertyChanged,
+                                  objectThatChanged,
+                                  propertyName);
+        }
+
+        void updateNestedObject(const juce::Identifier& propertyName, const juce::var& value)
+        {
+            auto* const nested = dynamic_cast<Object*>(value.getDynamicObject());
+            const auto existing = nestedObjects.find(propertyName);
+
+            if (existing != std::end(nestedObjects))
             {
-                for (const auto& nested : findNestedObjects())
-                    nested->addListener(*this);
+                if (existing->second == nested)
+                    return;
+
+                detachFrom(*existing->second);
+                nestedObjects.erase(existing);
             }
-            else
+
+            if (nested != nullptr)
             {
-                object.listeners.callExcluding(this,
-                                               &Listener::propertyChanged,
-                                               objectThatChanged,
-                                               propertyName);
+                attachTo(*nested);
+                nestedObjects.emplace(propertyName, nested);
             }
         }
 
     private:
-        juce::Array<Object*> findNestedObjects()
+        void attachTo(Object& nested)
         {
-            juce::Array<Object*> nestedObjects;
+            if (attachments[&nested]++ == 0)
+                nested.addListener(*this);
+        }
 
-            for (auto& [name, value] : object.getProperties())
+        void detachFrom(Object& nested)
+        {
+            const auto attachment = attachments.find(&nested);
+            jassert(attachment != std::end(attachments));
+
+            if (--attachment->second == 0)
             {
-                if (auto* nested = dynamic_cast<Object*>(value.getDynamicObject()))
-                {
-                    nestedObjects.add(nested);
-                }
+                nested.removeListener(*this);
+                attachments.erase(attachment);
             }
-
-            return nestedObjects;
         }
 
         Object& object;
+
+        // Holding a reference keeps each nested object alive for long enough
+        // to detach from it, even if its property is replaced without going
+        // through setProperty().
+        std::unordered_map<juce::Identifier, ReferenceCountedPointer> nestedObjects;
+
+        // The same object may be nested under more than one name.
+        std::unordered_map<Object*, int> attachments;
     };
 
     Object::Object()
@@ -69,9 +96,12 @@ namespace jive
 
     Object::Object(const juce::DynamicObject& other)
         : juce::DynamicObject{ other }
+        , internalListener{ std::make_unique<InternalListener>(*this) }
     {
     }
 
+    Object::~Object() = default;
+
     void Object::setProperty(const juce::Identifier& propertyName,
                              const juce::var& newValue)
     {
@@ -79,12 +109,24 @@ namespace jive
                                          .set(propertyName, newValue);
 
         if (propertyChanged)
+        {
+            internalListener->updateNestedObject(propertyName, newValue);
             listeners.call(&Listener::propertyChanged, *this, propertyName);
+        }
+    }
+
+    void Object::removeProperty(const juce::Identifier& propertyName)
+    {
+        if (!DynamicObject::getProperties().remove(propertyName))
+            return;
+
+        internalListener->updateNestedObject(propertyName, {});
+        listeners.call(&Listener::propertyChanged, *this, propertyName);
     }
 
     const juce::NamedValueSet& Object::getProperties() const
     {
-        return dynamic_cast<juce::DynamicObject*>(const_cast<Object*>(this))->getProperties();
+        return dynamic_cast<const juce::DynamicObject*>(this)->getProperties();
     }
 
     void Object::addListener(Listener& listener) const
@@ -97,7 +139,7 @@ namespace jive
         listeners.remove(&listener);
     }
 
-    void replaceDynamicObjectsWithJiveObjects(juce::var& value)
+    static void replaceDynamicObjectsWithJiveObjects(juce::var& value)
     {
         if (auto* dynamicObject = value.getDynamicObject())
         {
@@ -129,7 +171,7 @@ namespace juce
     jive::Object::ReferenceCountedPointer VariantConverter<jive::Object::ReferenceCountedPointer>::fromVar(const var& value)
     {
         if (value.isString())
-            return fromVar(jive::parseJSON(value.toString()));
+            return fromVar(jive::ObjectCache::parseJSON(value.toString()));
 
         if (auto* dynamicObject = value.getDynamicObject())
         {
@@ -160,6 +202,7 @@ public:
     void runTest() final
     {
         testListener();
+        testNestedObjects();
         testJsonParsing();
     }
 
@@ -204,6 +247,53 @@ private:
         expect(callbackCalled);
     }
 
+    void testNestedObjects()
+    {
+        beginTest("nested objects");
+
+        jive::Object::ReferenceCountedPointer first = new jive::Object;
+        jive::Object::ReferenceCountedPointer second = new jive::Object;
+
+        auto numCalls = 0;
+        Listener listener;
+        listener.onPropertyChange = [&numCalls]() {
+            numCalls++;
+        };
+
+        {
+            jive::Object object;
+            object.setProperty("nested", juce::var{ first.get() });
+            object.setProperty("also-nested", juce::var{ first.get() });
+            object.addListener(listener);
+
+            first->setProperty("value", 1);
+            expectEquals(numCalls, 1);
+
+            object.setProperty("nested", juce::var{ second.get() });
+            numCalls = 0;
+            first->setProperty("value", 2);
+            second->setProperty("value", 3);
+            expectEquals(numCalls, 2);
+
+            object.setProperty("also-nested", 123);
+            numCalls = 0;
+            first->setProperty("value", 4);
+            expectEquals(numCalls, 0);
+
+            object.removeProperty("nested");
+            expectEquals(numCalls, 1);
+            second->setProperty("value", 5);
+            expectEquals(numCalls, 1);
+
+            object.setProperty("nested", juce::var{ second.get() });
+            object.removeListener(listener);
+        }
+
+        // The parent has gone, so the nested objects must no longer refer to it.
+        first->setProperty("value", 6);
+        second->setProperty("value", 7);
+    }
+
     void testJsonParsing()
     {
         beginTest("JSON parsing");
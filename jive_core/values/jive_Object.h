@@ -22,8 +22,11 @@ namespace jive
 
         Object(const juce::DynamicObject& other);
 
+        ~Object() override;
+
         void setProperty(const juce::Identifier& propertyName,
                          const juce::var& newValue) override;
+        void removeProperty(const juce::Identifier& propertyName) override;
         const juce::NamedValueSet& getProperties() const;
 
         void addListener(Listener& listener) const;
@@ -33,7 +36,7 @@ namespace jive
         class InternalListener;
 
         mutable juce::ListenerList<Listener> listeners;
-        const std::unique_ptr<Listener> internalListener;
+        const std::unique_ptr<InternalListener> internalListener;
 
         JUCE_LEAK_DETECTOR(Object)
     };
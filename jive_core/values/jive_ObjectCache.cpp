@@ -0,0 +1,381 @@
+#include <jive_core/jive_core.h>
+
+namespace jive
+{
+    // Writes to the nested objects of one copy mustn't affect any other, so
+    // they're copied as well.
+    static juce::var copyWithNestedObjects(const juce::var& value)
+    {
+        const auto* const object = dynamic_cast<const Object*>(value.getDynamicObject());
+
+        if (object == nullptr)
+            return value;
+
+        juce::DynamicObject copy{ *object };
+
+        for (auto& [name, nestedValue] : copy.getProperties())
+            nestedValue = copyWithNestedObjects(nestedValue);
+
+        return new Object{ copy };
+    }
+
+    struct ObjectCache::Cache
+    {
+        struct Entry
+        {
+            juce::String jsonString;
+            Object::ReferenceCountedPointer object;
+        };
+
+        void moveToFront(std::list<Entry>::iterator entry)
+        {
+            entries.splice(std::begin(entries), entries, entry);
+        }
+
+        void evictUntilWithin(int maxNumObjects)
+        {
+            while (static_cast<int>(entries.size()) > maxNumObjects)
+            {
+                index.erase(entries.back().jsonString);
+                entries.pop_back();
+            }
+        }
+
+        juce::CriticalSection lock;
+
+        // Most recently used first.
+        std::list<Entry> entries;
+        std::unordered_map<juce::String, std::list<Entry>::iterator> index;
+
+        int maxNumObjects{ 256 };
+    };
+
+    juce::var ObjectCache::parseJSON(const juce::String& jsonString)
+    {
+        auto& cache = getCache();
+        Object::ReferenceCountedPointer object;
+
+        {
+            const juce::ScopedLock lock{ cache.lock };
+
+            if (const auto entry = cache.index.find(jsonString);
+                entry != std::end(cache.index))
+            {
+                cache.moveToFront(entry->second);
+                object = entry->second->object;
+            }
+        }
+
+        // The cached objects are never written to, so they can be copied
+        // outside of the lock.
+        if (object != nullptr)
+            return copyWithNestedObjects(juce::var{ object.get() });
+
+        const auto value = jive::parseJSON(jsonString);
+        object = dynamic_cast<Object*>(value.getDynamicObject());
+
+        if (object == nullptr)
+            return value;
+
+        {
+            const juce::ScopedLock lock{ cache.lock };
+
+            // Another thread may have parsed the same text in the meantime.
+            if (cache.index.count(jsonString) == 0)
+            {
+                cache.entries.push_front({ jsonString, object });
+                cache.index.emplace(jsonString, std::begin(cache.entries));
+                cache.evictUntilWithin(cache.maxNumObjects);
+            }
+        }
+
+        return copyWithNestedObjects(value);
+    }
+
+    void ObjectCache::setMaxNumCachedObjects(int maxNumObjects)
+    {
+        jassert(maxNumObjects >= 0);
+
+        auto& cache = getCache();
+        const juce::ScopedLock lock{ cache.lock };
+
+        cache.maxNumObjects = maxNumObjects;
+        cache.evictUntilWithin(maxNumObjects);
+    }
+
+    int ObjectCache::getMaxNumCachedObjects()
+    {
+        auto& cache = getCache();
+        const juce::ScopedLock lock{ cache.lock };
+
+        return cache.maxNumObjects;
+    }
+
+    int ObjectCache::getNumCachedObjects()
+    {
+        auto& cache = getCache();
+        const juce::ScopedLock lock{ cache.lock };
+
+        return static_cast<int>(cache.entries.size());
+    }
+
+    ObjectCache::Cache& ObjectCache::getCache()
+    {
+        static Cache cache;
+        return cache;
+    }
+} // namespace jive
+
+#if JIVE_UNIT_TESTS
+class ObjectCacheUnitTest : public juce::UnitTest
+{
+public:
+    ObjectCacheUnitTest()
+        : juce::UnitTest{ "jive::ObjectCache", "jive" }
+    {
+    }
+
+    void runTest() final
+    {
+        testHits();
+        testIndependentCopies();
+        testNestedObjects();
+        testDynamicObjectInterface();
+        testGradientRoundTrip();
+        testEviction();
+    }
+
+private:
+    struct Listener : public jive::Object::Listener
+    {
+        void propertyChanged(jive::Object&, const juce::Identifier&) final
+        {
+            numCalls++;
+        }
+
+        int numCalls = 0;
+    };
+
+    static jive::Object::ReferenceCountedPointer parse(const juce::String& json)
+    {
+        return juce::VariantConverter<jive::Object::ReferenceCountedPointer>::fromVar(json);
+    }
+
+    void testHits()
+    {
+        beginTest("hits");
+
+        const juce::String json{ R"({ "object-cache-hits": 1 })" };
+        const auto numCachedObjects = jive::ObjectCache::getNumCachedObjects();
+
+        const auto first = parse(json);
+        const auto second = parse(json);
+        expectEquals(jive::ObjectCache::getNumCachedObjects(),
+                     juce::jmin(numCachedObjects + 1, jive::ObjectCache::getMaxNumCachedObjects()));
+        expect(first != second);
+        expectEquals(first->getProperty("object-cache-hits"), juce::var{ 1 });
+        expectEquals(second->getProperty("object-cache-hits"), juce::var{ 1 });
+
+        const auto notAnObject = jive::ObjectCache::parseJSON("[1, 2, 3]");
+        expect(notAnObject.isArray());
+        expectEquals(jive::ObjectCache::getNumCachedObjects(),
+                     juce::jmin(numCachedObjects + 1, jive::ObjectCache::getMaxNumCachedObjects()));
+    }
+
+    void testIndependentCopies()
+    {
+        beginTest("independent copies");
+
+        const juce::String json{ R"({ "object-cache-independent": 1, "other": 2 })" };
+        const auto first = parse(json);
+        const auto second = parse(json);
+
+        Listener listener;
+        first->addListener(listener);
+
+        first->setProperty("object-cache-independent", 3);
+        expectEquals(listener.numCalls, 1);
+        expectEquals(first->getProperty("object-cache-independent"), juce::var{ 3 });
+        expectEquals(first->getProperty("other"), juce::var{ 2 });
+        expectEquals(second->getProperty("object-cache-independent"), juce::var{ 1 });
+
+        second->removeProperty("other");
+        expect(!second->hasProperty("other"));
+        expect(first->hasProperty("other"));
+        expectEquals(parse(json)->getProperty("other"), juce::var{ 2 });
+
+        first->removeListener(listener);
+    }
+
+    void testNestedObjects()
+    {
+        beginTest("nested objects");
+
+        const juce::String json{ R"({ "object-cache-nested": { "hover": { "value": 1 } } })" };
+        const auto first = parse(json);
+        const auto second = parse(json);
+
+        Listener listener;
+        first->addListener(listener);
+
+        auto* nested = dynamic_cast<jive::Object*>(first->getProperty("object-cache-nested").getDynamicObject());
+        expect(nested != nullptr);
+        auto* hover = dynamic_cast<jive::Object*>(nested->getProperty("hover").getDynamicObject());
+        expect(hover != nullptr);
+        hover->setProperty("value", 2);
+        expectEquals(listener.numCalls, 1);
+
+        expectEquals(first->getProperty("object-cache-nested")["hover"]["value"], juce::var{ 2 });
+        expectEquals(second->getProperty("object-cache-nested")["hover"]["value"], juce::var{ 1 });
+        expectEquals(parse(json)->getProperty("object-cache-nested")["hover"]["value"], juce::var{ 1 });
+
+        first->setProperty("unrelated", 3);
+        hover->setProperty("value", 4);
+        expectEquals(listener.numCalls, 3);
+        expectEquals(first->getProperty("object-cache-nested")["hover"]["value"], juce::var{ 4 });
+
+        first->removeListener(listener);
+    }
+
+    void testDynamicObjectInterface()
+    {
+        beginTest("DynamicObject interface");
+
+        const juce::String json{ R"({ "object-cache-dynamic-object": 1, "nested": { "value": 2 } })" };
+        const auto first = parse(json);
+        const auto second = parse(json);
+
+        // Code that only knows about DynamicObject should see the same
+        // properties as code that goes through Object.
+        const juce::DynamicObject& dynamicObject = *first;
+        expectEquals(dynamicObject.getProperties().size(), 2);
+        expectEquals(dynamicObject.getProperties()["object-cache-dynamic-object"], juce::var{ 1 });
+        expectEquals(dynamicObject.getProperties()["nested"]["value"], juce::var{ 2 });
+
+        const auto text = juce::JSON::toString(juce::var{ first.get() }, true);
+        expect(text.contains("object-cache-dynamic-object"));
+        expect(text.contains("\"value\": 2") || text.contains("\"value\":2"));
+
+        const auto clone = first->clone();
+        expectEquals(clone->getProperties().size(), 2);
+        expectEquals(clone->getProperty("nested")["value"], juce::var{ 2 });
+
+        // Nested objects read through the DynamicObject interface are still
+        // private to their copy.
+        dynamicObject.getProperties()["nested"].getDynamicObject()->setProperty("value", 3);
+        expectEquals(first->getProperty("nested")["value"], juce::var{ 3 });
+        expectEquals(second->getProperty("nested")["value"], juce::var{ 2 });
+    }
+
+    void testGradientRoundTrip()
+    {
+        beginTest("gradient round trip");
+
+        const juce::String json{ R"({
+            "object-cache-gradient": {
+                "gradient": "linear",
+                "stops": {
+                    "0": "#111111",
+                    "1": "#999999"
+                }
+            }
+        })" };
+        const auto first = parse(json);
+        const auto second = parse(json);
+
+        const auto gradient = juce::VariantConverter<jive::Gradient>::fromVar(second->getProperty("object-cache-gradient"));
+        expect(gradient.variant == jive::Gradient::Variant::linear);
+        expectEquals(gradient.stops.size(), 2);
+        expect(gradient.stops[0].colour == juce::Colour{ 0xFF111111 });
+        expect(gradient.stops[1].colour == juce::Colour{ 0xFF999999 });
+
+        const auto roundTripped = juce::VariantConverter<jive::Gradient>::fromVar(juce::VariantConverter<jive::Gradient>::toVar(gradient));
+        expect(roundTripped == gradient);
+        expect(juce::VariantConverter<jive::Gradient>::fromVar(first->getProperty("object-cache-gradient")) == gradient);
+    }
+
+    void testEviction()
+    {
+        beginTest("eviction");
+
+        const auto maxNumCachedObjects = jive::ObjectCache::getMaxNumCachedObjects();
+        jive::ObjectCache::setMaxNumCachedObjects(3);
+        expect(jive::ObjectCache::getNumCachedObjects() <= 3);
+
+        for (auto i = 0; i < 5; i++)
+            parse(R"({ "object-cache-eviction": )" + juce::String{ i } + " }");
+
+        expectEquals(jive::ObjectCache::getNumCachedObjects(), 3);
+
+        // Objects in use are unaffected by their text being evicted.
+        const auto object = parse(R"({ "object-cache-eviction": "in use" })");
+
+        for (auto i = 0; i < 5; i++)
+            parse(R"({ "object-cache-eviction": )" + juce::String{ i } + " }");
+
+        expectEquals(object->getProperty("object-cache-eviction"), juce::var{ "in use" });
+        expectEquals(jive::ObjectCache::getNumCachedObjects(), 3);
+
+        jive::ObjectCache::setMaxNumCachedObjects(maxNumCachedObjects);
+    }
+};
+
+static ObjectCacheUnitTest objectCacheUnitTest;
+
+class ObjectCacheBenchmark : public juce::UnitTest
+{
+public:
+    ObjectCacheBenchmark()
+        : juce::UnitTest{ "jive::ObjectCache", "jive-micro-benchmarks" }
+    {
+    }
+
+    void runTest() final
+    {
+        beginTest("style loading");
+
+        const juce::String json{ R"({
+            "background": "#FF00FF",
+            "foreground": "rgb(10, 20, 30)",
+            "border-radius": "5 10",
+            "font-family": "Helvetica",
+            "font-size": 14,
+            "hover": { "background": "#00FF00" },
+            "active": { "background": "#0000FF" },
+            "disabled": { "foreground": "#777777" }
+        })" };
+
+        const auto parseTime = measureMicrosecondsPerStyle([&json]() {
+            return jive::parseJSON(json);
+        });
+        const auto cachedTime = measureMicrosecondsPerStyle([&json]() {
+            return jive::ObjectCache::parseJSON(json);
+        });
+
+        logMessage(juce::String{ parseTime, 2 } + "us per style when parsed, "
+                   + juce::String{ cachedTime, 2 } + "us per style when cached");
+    }
+
+private:
+    static constexpr auto numStyles = 10000;
+
+    template <typename ParseFunction>
+    double measureMicrosecondsPerStyle(ParseFunction&& parse)
+    {
+        juce::Array<juce::var> styles;
+        styles.ensureStorageAllocated(numStyles);
+
+        const auto start = juce::Time::getHighResolutionTicks();
+
+        for (auto i = 0; i < numStyles; i++)
+            styles.add(parse());
+
+        const auto seconds = juce::Time::highResolutionTicksToSeconds(juce::Time::getHighResolutionTicks() - start);
+        expect(styles.getLast()["hover"]["background"] == juce::var{ "#00FF00" });
+
+        return seconds * 1.0e6 / numStyles;
+    }
+};
+
+static ObjectCacheBenchmark objectCacheBenchmark;
+#endif
@@ -0,0 +1,29 @@
+#pragma once
+
+#include "jive_Object.h"
+
+namespace jive
+{
+    // A least-recently-used cache of objects parsed from JSON, keyed on the
+    // text, so styles that repeat the same text are only parsed once. Each
+    // call returns a copy of its own, with copies of any nested objects, so
+    // it can be written to without affecting any other. Copying the values
+    // doesn't copy the strings or arrays they refer to, so a copy costs much
+    // less than parsing the text again. Safe to use from any thread.
+    class ObjectCache
+    {
+    public:
+        static juce::var parseJSON(const juce::String& jsonString);
+
+        // The least recently used objects are dropped once more than this
+        // many are cached.
+        static void setMaxNumCachedObjects(int maxNumObjects);
+        static int getMaxNumCachedObjects();
+
+        static int getNumCachedObjects();
+
+    private:
+        struct Cache;
+        static Cache& getCache();
+    };
+} // namespace jive
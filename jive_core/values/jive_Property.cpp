@@ -16,6 +16,8 @@ public:
         testCallback();
         testInitialValue();
         testHereditaryValues();
+        testAncestorResolution();
+        testCaching();
     }
 
 private:
@@ -184,6 +186,145 @@ private:
             expectEquals(value.get(), 777);
         }
     }
+
+    void testAncestorResolution()
+    {
+        beginTest("ancestor resolution");
+
+        juce::ValueTree root{
+            "Root",
+            {
+                { "value", 111 },
+            },
+            {
+                juce::ValueTree{
+                    "Parent",
+                    {},
+                    {
+                        juce::ValueTree{ "Child" },
+                    },
+                },
+                juce::ValueTree{ "Sibling" },
+            },
+        };
+        auto child = root.getChild(0).getChild(0);
+        jive::Property<int, jive::HereditaryValueBehaviour::inheritFromAncestors> value{ child, "value" };
+
+        auto numCallbacks = 0;
+        value.onValueChange = [&numCallbacks]() {
+            numCallbacks++;
+        };
+        expectEquals(value.get(), 111);
+
+        root.getChild(1).setProperty("value", 222, nullptr);
+        expectEquals(numCallbacks, 0);
+        expectEquals(value.get(), 111);
+
+        root.getChild(0).setProperty("value", 333, nullptr);
+        expectEquals(numCallbacks, 1);
+        expectEquals(value.get(), 333);
+
+        root.getChild(0).removeProperty("value", nullptr);
+        expectEquals(value.get(), 111);
+
+        juce::ValueTree otherRoot{
+            "OtherRoot",
+            {
+                { "value", 444 },
+            },
+        };
+        root.getChild(0).removeChild(child, nullptr);
+        otherRoot.appendChild(child, nullptr);
+        expectEquals(value.get(), 444);
+
+        otherRoot.setProperty("value", 555, nullptr);
+        expectEquals(numCallbacks, 2);
+        expectEquals(value.get(), 555);
+
+        root.setProperty("value", 666, nullptr);
+        expectEquals(numCallbacks, 2);
+        expectEquals(value.get(), 555);
+
+        {
+            // The property's own callbacks aren't made until the transaction
+            // is committed, but reads should see the new ancestor straight
+            // away.
+            jive::StateTransaction transaction;
+            juce::ValueTree parent{ "Parent", { { "value", 777 } } };
+            otherRoot.removeChild(child, nullptr);
+            otherRoot.appendChild(parent, nullptr);
+            parent.appendChild(child, nullptr);
+            expectEquals(value.get(), 777);
+
+            parent.removeProperty("value", nullptr);
+            expectEquals(value.get(), 555);
+
+            child.getParent().setProperty("value", 888, nullptr);
+            expectEquals(value.get(), 888);
+        }
+
+        expectEquals(value.get(), 888);
+
+        // Subscribers to an ancestor that are called before the property
+        // should also see the new ancestor.
+        jive::Property<int> parentValue{ child.getParent(), "value" };
+        auto valueSeenByParent = 0;
+        parentValue.onValueChange = [&valueSeenByParent, &value]() {
+            valueSeenByParent = value.get();
+        };
+        child.getParent().removeProperty("value", nullptr);
+        expectEquals(value.get(), 555);
+        child.getParent().setProperty("value", 999, nullptr);
+        expectEquals(valueSeenByParent, 999);
+
+        // Properties that don't inherit shouldn't pay for keeping track of
+        // their ancestors.
+        expectLessThan(sizeof(jive::Property<int>),
+                       sizeof(jive::Property<int, jive::HereditaryValueBehaviour::inheritFromAncestors>));
+    }
+
+    void testCaching()
+    {
+        beginTest("caching");
+
+        juce::ValueTree tree{ "Tree", { { "value", "10 20" } } };
+        jive::CachedProperty<juce::BorderSize<float>> value{ tree, "value" };
+        jive::PropertyCacheStatistics::reset();
+
+        expect(value.get() == juce::BorderSize<float>{ 10.0f, 20.0f, 10.0f, 20.0f });
+        expectEquals(jive::PropertyCacheStatistics::getNumMisses(), static_cast<juce::int64>(1));
+        expectEquals(jive::PropertyCacheStatistics::getNumHits(), static_cast<juce::int64>(0));
+
+        expect(value.get() == juce::BorderSize<float>{ 10.0f, 20.0f, 10.0f, 20.0f });
+        expectEquals(jive::PropertyCacheStatistics::getNumMisses(), static_cast<juce::int64>(1));
+        expectEquals(jive::PropertyCacheStatistics::getNumHits(), static_cast<juce::int64>(1));
+
+        tree.setProperty("value", "1 2 3 4", nullptr);
+        expect(value.get() == juce::BorderSize<float>{ 1.0f, 4.0f, 3.0f, 2.0f });
+        expectEquals(jive::PropertyCacheStatistics::getNumMisses(), static_cast<juce::int64>(2));
+
+        tree.removeProperty("value", nullptr);
+        expect(value.get() == juce::BorderSize<float>{});
+        expectEquals(jive::PropertyCacheStatistics::getNumMisses(), static_cast<juce::int64>(3));
+
+        {
+            juce::ValueTree other{ "Tree", { { "value", "5" } } };
+            jive::CachedProperty<juce::BorderSize<float>> first{ other, "value" };
+            jive::CachedProperty<juce::BorderSize<float>> second{ other, "value" };
+            expect(first.get() == juce::BorderSize<float>{ 5.0f });
+
+            second.onValueChange = [this, &first]() {
+                expect(first.get() == juce::BorderSize<float>{ 6.0f });
+            };
+            other.setProperty("value", "6", nullptr);
+        }
+
+        expectGreaterThan(jive::PropertyCacheStatistics::getHitRate(), 0.0);
+
+        // Properties that don't cache shouldn't pay for the storage.
+        expectLessThan(sizeof(jive::Property<juce::BorderSize<float>>),
+                       sizeof(jive::CachedProperty<juce::BorderSize<float>>));
+    }
 };
 
 static PropertyUnitTest propertyUnitTest;
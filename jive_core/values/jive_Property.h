@@ -1,6 +1,8 @@
 #pragma once
 
 #include "jive_Object.h"
+#include "jive_ObjectCache.h"
+#include "jive_PropertyDispatcher.h"
 
 namespace jive
 {
@@ -11,9 +13,227 @@ namespace jive
         doNotInherit,
     };
 
+    enum class CachingBehaviour
+    {
+        cacheConvertedValue,
+        doNotCache,
+    };
+
+    class PropertyCacheStatistics
+    {
+    public:
+        static juce::int64 getNumHits() noexcept
+        {
+            return hits.load(std::memory_order_relaxed);
+        }
+
+        static juce::int64 getNumMisses() noexcept
+        {
+            return misses.load(std::memory_order_relaxed);
+        }
+
+        static double getHitRate() noexcept
+        {
+            const auto numHits = getNumHits();
+            const auto numLookups = numHits + getNumMisses();
+
+            if (numLookups == 0)
+                return 0.0;
+
+            return static_cast<double>(numHits) / static_cast<double>(numLookups);
+        }
+
+        static void reset() noexcept
+        {
+            hits.store(0, std::memory_order_relaxed);
+            misses.store(0, std::memory_order_relaxed);
+        }
+
+    private:
+        template <typename, CachingBehaviour>
+        friend class PropertyValueCache;
+
+        static inline std::atomic<juce::int64> hits{ 0 };
+        static inline std::atomic<juce::int64> misses{ 0 };
+    };
+
+    // True if a value converted from the cached source can be reused for the
+    // given source. Other listeners may read a property before its own
+    // listener has had the chance to invalidate a cache, so a cache is only
+    // trusted if its source is still the current value.
+    inline bool isSameSource(const juce::var& cachedSource, const juce::var& source)
+    {
+        if (cachedSource.isString() && source.isString())
+        {
+            const auto cachedText = cachedSource.toString();
+            const auto text = source.toString();
+
+            return cachedText.getCharPointer() == text.getCharPointer()
+                || cachedText == text;
+        }
+
+        return cachedSource.equalsWithSameType(source);
+    }
+
+    // Holds the last converted value for properties that cache it. Properties
+    // that don't cache inherit the empty version, which takes up no space.
+    template <typename ValueType, CachingBehaviour cachingBehaviour>
+    class PropertyValueCache
+    {
+    protected:
+        void resetCache() const noexcept
+        {
+        }
+    };
+
+    template <typename ValueType>
+    class PropertyValueCache<ValueType, CachingBehaviour::cacheConvertedValue>
+    {
+    protected:
+        using Converter = juce::VariantConverter<ValueType>;
+
+        void resetCache() const noexcept
+        {
+            cache.reset();
+        }
+
+        ValueType getCachedValue(const juce::var& source) const
+        {
+            // Objects and arrays can be modified in-place without the tree
+            // being notified, so there's no cheap way to tell if a cached
+            // conversion of them is stale.
+            if (source.isObject() || source.isArray())
+                return Converter::fromVar(source);
+
+            if (cache.has_value() && isSameSource(cache->source, source))
+            {
+                PropertyCacheStatistics::hits.fetch_add(1, std::memory_order_relaxed);
+                return cache->value;
+            }
+
+            PropertyCacheStatistics::misses.fetch_add(1, std::memory_order_relaxed);
+            cache = CachedValue{ source, Converter::fromVar(source) };
+
+            return cache->value;
+        }
+
+    private:
+        struct CachedValue
+        {
+            juce::var source;
+            ValueType value;
+        };
+
+        mutable std::optional<CachedValue> cache;
+    };
+
+    // Keeps track of the ancestors that hereditary properties inherit their
+    // values from. Properties that don't inherit use the empty version, which
+    // takes up no space.
+    template <HereditaryValueBehaviour hereditaryBehavior>
+    class PropertyAncestors
+    {
+    protected:
+        void resetResolvedAncestor() const noexcept
+        {
+            resolvedAncestor.reset();
+        }
+
+        void subscribeToAncestorDispatchers(const juce::ValueTree& tree,
+                                            const juce::Identifier& id,
+                                            PropertyDispatcher::Subscriber& subscriber)
+        {
+            for (auto ancestor = tree.getParent(); ancestor.isValid(); ancestor = ancestor.getParent())
+            {
+                ancestorDispatchers.push_back(PropertyDispatcher::getDispatcherFor(ancestor));
+                ancestorDispatchers.back()->subscribe(id, subscriber, PropertyDispatcher::Scope::thisTreeOnly);
+
+                if constexpr (hereditaryBehavior == HereditaryValueBehaviour::inheritFromParent)
+                    break;
+            }
+        }
+
+        void unsubscribeFromAncestorDispatchers(const juce::Identifier& id,
+                                                PropertyDispatcher::Subscriber& subscriber)
+        {
+            for (auto& dispatcher : ancestorDispatchers)
+                dispatcher->unsubscribe(id, subscriber, PropertyDispatcher::Scope::thisTreeOnly);
+
+            ancestorDispatchers.clear();
+        }
+
+        juce::var findPropertyInLatestAncestor(const juce::ValueTree& tree,
+                                               const juce::Identifier& id) const
+        {
+            // The ancestor that the value is inherited from is only looked up
+            // again once the property changes on a tree along the chain of
+            // ancestors, or once one of them is moved to a new parent. The
+            // cached ancestor is checked against the number of changes rather
+            // than relying on our own callbacks, which may not have been made
+            // yet during a transaction, or when another subscriber reads this
+            // property first.
+            const auto numChanges = PropertyDispatcher::getNumChanges(id);
+
+            if (!resolvedAncestor.has_value() || resolvedAncestor->numChanges != numChanges)
+            {
+                auto treeToSearch = tree.getParent();
+
+                while (treeToSearch.isValid() && !treeToSearch.hasProperty(id))
+                    treeToSearch = treeToSearch.getParent();
+
+                resolvedAncestor = ResolvedAncestor{ treeToSearch, numChanges };
+            }
+
+            if (resolvedAncestor->tree.isValid())
+                return resolvedAncestor->tree[id];
+
+            return {};
+        }
+
+    private:
+        struct ResolvedAncestor
+        {
+            juce::ValueTree tree;
+            std::uint64_t numChanges;
+        };
+
+        std::vector<PropertyDispatcher::ReferenceCountedPointer> ancestorDispatchers;
+        mutable std::optional<ResolvedAncestor> resolvedAncestor;
+    };
+
+    template <>
+    class PropertyAncestors<HereditaryValueBehaviour::doNotInherit>
+    {
+    protected:
+        void resetResolvedAncestor() const noexcept
+        {
+        }
+
+        void subscribeToAncestorDispatchers(const juce::ValueTree&,
+                                            const juce::Identifier&,
+                                            PropertyDispatcher::Subscriber&)
+        {
+        }
+
+        void unsubscribeFromAncestorDispatchers(const juce::Identifier&,
+                                                PropertyDispatcher::Subscriber&)
+        {
+        }
+
+        juce::var findPropertyInLatestAncestor(const juce::ValueTree&,
+                                               const juce::Identifier&) const
+        {
+            return {};
+        }
+    };
+
     template <typename ValueType,
-              HereditaryValueBehaviour hereditaryBehavior = HereditaryValueBehaviour::doNotInherit>
-    class Property : protected juce::ValueTree::Listener
+              HereditaryValueBehaviour hereditaryBehavior = HereditaryValueBehaviour::doNotInherit,
+              CachingBehaviour cachingBehaviour = CachingBehaviour::doNotCache>
+    class Property
+        : protected PropertyDispatcher::Subscriber
+        , private PropertyValueCache<ValueType, cachingBehaviour>
+        , private PropertyAncestors<hereditaryBehavior>
     {
     public:
         using Converter = juce::VariantConverter<ValueType>;
@@ -23,27 +243,12 @@ namespace jive
             : id{ propertyID }
             , tree{ sourceTree }
         {
-            switch (hereditaryBehavior)
-            {
-            case HereditaryValueBehaviour::inheritFromParent:
-                treeToListenTo = tree.getParent();
-                break;
-            case HereditaryValueBehaviour::inheritFromAncestors:
-                treeToListenTo = tree.getRoot();
-                break;
-            case HereditaryValueBehaviour::doNotInherit:
-                treeToListenTo = tree;
-            }
-
-            if (!treeToListenTo.isValid())
-                treeToListenTo = tree;
-
-            treeToListenTo.addListener(this);
+            subscribeToDispatchers();
 
             if constexpr (std::is_same<ValueType, Object::ReferenceCountedPointer>())
             {
                 if (tree[id].isString())
-                    tree.setProperty(id, parseJSON(tree[id].toString()), nullptr);
+                    tree.setProperty(id, ObjectCache::parseJSON(tree[id].toString()), nullptr);
             }
         }
 
@@ -56,23 +261,23 @@ namespace jive
                 *this = initialValue;
         }
 
-        virtual ValueType get() const
+        Property(const Property& other)
+            : Property{ other.tree, other.id }
         {
-            if (exists())
-                return Converter::fromVar(tree[id]);
+            onValueChange = other.onValueChange;
+        }
 
-            switch (hereditaryBehavior)
-            {
-            case HereditaryValueBehaviour::inheritFromParent:
-                return Converter::fromVar(tree.getParent()[id]);
-            case HereditaryValueBehaviour::inheritFromAncestors:
-                return Converter::fromVar(findPropertyInLatestAncestor());
-            case HereditaryValueBehaviour::doNotInherit:
-                return Converter::fromVar(tree[id]);
-            }
+        ~Property() override
+        {
+            unsubscribeFromDispatchers();
+        }
 
-            jassertfalse;
-            return Converter::fromVar(juce::var{});
+        virtual ValueType get() const
+        {
+            if constexpr (cachingBehaviour == CachingBehaviour::cacheConvertedValue)
+                return this->getCachedValue(getSourceValue());
+            else
+                return Converter::fromVar(getSourceValue());
         }
 
         ValueType getOr(const ValueType& valueIfNotExists) const
@@ -139,7 +344,7 @@ namespace jive
             return get();
         }
 
-        Property<ValueType, hereditaryBehavior>& operator=(const ValueType& newValue)
+        Property<ValueType, hereditaryBehavior, cachingBehaviour>& operator=(const ValueType& newValue)
         {
             set(newValue);
             return *this;
@@ -154,17 +359,33 @@ namespace jive
         {
             if (property != id)
                 return;
-            if (!treeWhosePropertyChanged.hasProperty(property))
-                return;
             if (!respondToPropertyChanges(treeWhosePropertyChanged))
                 return;
 
+            this->resetCache();
+            this->resetResolvedAncestor();
+
+            if (!treeWhosePropertyChanged.hasProperty(property))
+                return;
+
             if (onValueChange != nullptr)
             {
                 onValueChange();
             }
         }
 
+        void valueTreeParentChanged(juce::ValueTree&) override
+        {
+            if constexpr (hereditaryBehavior != HereditaryValueBehaviour::doNotInherit)
+            {
+                this->resetCache();
+                this->resetResolvedAncestor();
+
+                this->unsubscribeFromAncestorDispatchers(id, *this);
+                this->subscribeToAncestorDispatchers(tree, id, *this);
+            }
+        }
+
         bool respondToPropertyChanges(juce::ValueTree& treeWhosePropertyChanged) const
         {
             if (treeWhosePropertyChanged == tree)
@@ -175,7 +396,9 @@ namespace jive
             case HereditaryValueBehaviour::inheritFromParent:
                 return treeWhosePropertyChanged == tree.getParent();
             case HereditaryValueBehaviour::inheritFromAncestors:
-                return tree.isAChildOf(treeWhosePropertyChanged);
+                // Only the dispatchers along the chain of ancestors are
+                // subscribed to, so there's no need to walk the tree here.
+                return true;
             case HereditaryValueBehaviour::doNotInherit:
                 return treeWhosePropertyChanged == tree;
             }
@@ -185,18 +408,54 @@ namespace jive
 
         juce::var findPropertyInLatestAncestor() const
         {
-            auto treeToSearch = tree.getParent();
+            return PropertyAncestors<hereditaryBehavior>::findPropertyInLatestAncestor(tree, id);
+        }
 
-            while (treeToSearch.isValid() && !treeToSearch.hasProperty(id))
-                treeToSearch = treeToSearch.getParent();
+        juce::var getSourceValue() const
+        {
+            if (exists())
+                return tree[id];
 
-            if (treeToSearch.isValid())
-                return treeToSearch[id];
+            switch (hereditaryBehavior)
+            {
+            case HereditaryValueBehaviour::inheritFromParent:
+                return tree.getParent()[id];
+            case HereditaryValueBehaviour::inheritFromAncestors:
+                return findPropertyInLatestAncestor();
+            case HereditaryValueBehaviour::doNotInherit:
+                return tree[id];
+            }
 
+            jassertfalse;
             return {};
         }
 
-        juce::ValueTree treeToListenTo;
         juce::ValueTree tree;
+
+    private:
+        void subscribeToDispatchers()
+        {
+            treeDispatcher = PropertyDispatcher::getDispatcherFor(tree);
+
+            if (treeDispatcher != nullptr)
+                treeDispatcher->subscribe(id, *this, PropertyDispatcher::Scope::thisTreeOnly);
+
+            this->subscribeToAncestorDispatchers(tree, id, *this);
+        }
+
+        void unsubscribeFromDispatchers()
+        {
+            if (treeDispatcher != nullptr)
+                treeDispatcher->unsubscribe(id, *this, PropertyDispatcher::Scope::thisTreeOnly);
+
+            this->unsubscribeFromAncestorDispatchers(id, *this);
+        }
+
+        PropertyDispatcher::ReferenceCountedPointer treeDispatcher;
     };
+
+    template <typename ValueType>
+    using CachedProperty = Property<ValueType,
+                                    HereditaryValueBehaviour::doNotInherit,
+                                    CachingBehaviour::cacheConvertedValue>;
 } // namespace jive
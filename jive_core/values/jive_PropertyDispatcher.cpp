@@ -0,0 +1,389 @@
+#include <jive_core/jive_core.h>
+
+namespace jive
+{
+    PropertyDispatcher::PropertyDispatcher(const juce::ValueTree& treeToDispatchFor)
+        : tree{ treeToDispatchFor }
+    {
+        jassert(tree.isValid());
+
+        getDispatchers()[&tree.getProperties()] = this;
+        tree.addListener(this);
+    }
+
+    PropertyDispatcher::~PropertyDispatcher()
+    {
+        tree.removeListener(this);
+        getDispatchers().erase(&tree.getProperties());
+    }
+
+    PropertyDispatcher::ReferenceCountedPointer PropertyDispatcher::getDispatcherFor(const juce::ValueTree& tree)
+    {
+        if (!tree.isValid())
+            return nullptr;
+
+        // A tree's property set lives for as long as the tree's shared data
+        // does, so its address identifies the tree without having to store
+        // anything in the tree itself.
+        const auto& dispatchers = getDispatchers();
+
+        if (const auto existing = dispatchers.find(&tree.getProperties());
+            existing != std::end(dispatchers))
+        {
+            return existing->second;
+        }
+
+        return new PropertyDispatcher{ tree };
+    }
+
+    void PropertyDispatcher::subscribe(const juce::Identifier& property, Subscriber& subscriber, Scope scope)
+    {
+        auto& route = routes[property];
+
+        if (route == nullptr)
+        {
+            route = std::make_unique<Route>();
+            route->numChanges = &getChangeCounts()[property];
+        }
+
+        if (scope == Scope::thisTreeOnly)
+        {
+            route->thisTree.add(&subscriber);
+        }
+        else
+        {
+            route->descendants.add(&subscriber);
+            numDescendantSubscribers++;
+        }
+    }
+
+    void PropertyDispatcher::unsubscribe(const juce::Identifier& property, Subscriber& subscriber, Scope scope)
+    {
+        const auto route = routes.find(property);
+
+        if (route == std::end(routes))
+        {
+            jassertfalse;
+            return;
+        }
+
+        if (scope == Scope::thisTreeOnly)
+        {
+            route->second->thisTree.remove(&subscriber);
+        }
+        else
+        {
+            route->second->descendants.remove(&subscriber);
+            numDescendantSubscribers--;
+        }
+    }
+
+    const juce::ValueTree& PropertyDispatcher::getTree() const noexcept
+    {
+        return tree;
+    }
+
+    std::uint64_t PropertyDispatcher::getNumChanges(const juce::Identifier& property)
+    {
+        const auto& changeCounts = getChangeCounts();
+
+        if (const auto count = changeCounts.find(property);
+            count != std::end(changeCounts))
+        {
+            return count->second;
+        }
+
+        return 0;
+    }
+
+    std::unordered_map<const juce::NamedValueSet*, PropertyDispatcher*>& PropertyDispatcher::getDispatchers()
+    {
+        static std::unordered_map<const juce::NamedValueSet*, PropertyDispatcher*> dispatchers;
+        return dispatchers;
+    }
+
+    std::unordered_map<juce::Identifier, std::uint64_t>& PropertyDispatcher::getChangeCounts()
+    {
+        // Elements of an unordered_map never move, so routes can hold on to
+        // the count for their property.
+        static std::unordered_map<juce::Identifier, std::uint64_t> changeCounts;
+        return changeCounts;
+    }
+
+    void PropertyDispatcher::dispatch(juce::ValueTree& treeWhosePropertyChanged, const juce::Identifier& property)
+    {
+        if (const auto route = routes.find(property);
+            route != std::end(routes))
+        {
+            dispatch(*route->second, treeWhosePropertyChanged, property);
+        }
+    }
+
+    void PropertyDispatcher::dispatch(Route& route,
+                                      juce::ValueTree& treeWhosePropertyChanged,
+                                      const juce::Identifier& property)
+    {
+        // Subscribers may release the last reference to this dispatcher from
+        // within their callbacks.
+        const ReferenceCountedPointer keepAlive{ this };
+
+        if (treeWhosePropertyChanged == tree)
+        {
+            route.thisTree.call([&treeWhosePropertyChanged, &property](Subscriber& subscriber) {
+                subscriber.valueTreePropertyChanged(treeWhosePropertyChanged, property);
+            });
+        }
+
+        route.descendants.call([&treeWhosePropertyChanged, &property](Subscriber& subscriber) {
+            subscriber.valueTreePropertyChanged(treeWhosePropertyChanged, property);
+        });
+    }
+
+    void PropertyDispatcher::valueTreePropertyChanged(juce::ValueTree& treeWhosePropertyChanged,
+                                                      const juce::Identifier& property)
+    {
+        if (treeWhosePropertyChanged != tree && numDescendantSubscribers == 0)
+            return;
+
+        const auto route = routes.find(property);
+
+        if (route == std::end(routes))
+            return;
+
+        if (treeWhosePropertyChanged == tree)
+            (*route->second->numChanges)++;
+
+        if (StateTransaction::deferPropertyChange(*this, treeWhosePropertyChanged, property))
+            return;
+
+        dispatch(*route->second, treeWhosePropertyChanged, property);
+    }
+
+    void PropertyDispatcher::valueTreeParentChanged(juce::ValueTree& treeWhoseParentChanged)
+    {
+        if (treeWhoseParentChanged != tree)
+            return;
+
+        const ReferenceCountedPointer keepAlive{ this };
+
+        for (auto& [property, route] : routes)
+            (*route->numChanges)++;
+
+        for (auto& [property, route] : routes)
+        {
+            route->thisTree.call([&treeWhoseParentChanged](Subscriber& subscriber) {
+                subscriber.valueTreeParentChanged(treeWhoseParentChanged);
+            });
+        }
+    }
+} // namespace jive
+
+#if JIVE_UNIT_TESTS
+class PropertyDispatcherUnitTest : public juce::UnitTest
+{
+public:
+    PropertyDispatcherUnitTest()
+        : juce::UnitTest{ "jive::PropertyDispatcher", "jive" }
+    {
+    }
+
+    void runTest() final
+    {
+        testSharedDispatcher();
+        testRouting();
+        testDescendants();
+    }
+
+private:
+    struct CountingSubscriber : public jive::PropertyDispatcher::Subscriber
+    {
+        void valueTreePropertyChanged(juce::ValueTree&, const juce::Identifier&) final
+        {
+            numCalls++;
+        }
+
+        int numCalls = 0;
+    };
+
+    void testSharedDispatcher()
+    {
+        beginTest("shared dispatcher");
+
+        juce::ValueTree tree{ "Tree" };
+        auto dispatcher = jive::PropertyDispatcher::getDispatcherFor(tree);
+        expect(dispatcher != nullptr);
+        expect(dispatcher->getTree() == tree);
+        expect(jive::PropertyDispatcher::getDispatcherFor(tree) == dispatcher);
+        expect(jive::PropertyDispatcher::getDispatcherFor(tree.createCopy()) != dispatcher);
+        expect(jive::PropertyDispatcher::getDispatcherFor(juce::ValueTree{}) == nullptr);
+    }
+
+    void testRouting()
+    {
+        beginTest("routing");
+
+        juce::ValueTree tree{ "Tree" };
+        auto dispatcher = jive::PropertyDispatcher::getDispatcherFor(tree);
+
+        CountingSubscriber first;
+        CountingSubscriber second;
+        dispatcher->subscribe("first", first, jive::PropertyDispatcher::Scope::thisTreeOnly);
+        dispatcher->subscribe("second", second, jive::PropertyDispatcher::Scope::thisTreeOnly);
+
+        tree.setProperty("first", 1, nullptr);
+        expectEquals(first.numCalls, 1);
+        expectEquals(second.numCalls, 0);
+
+        tree.setProperty("second", 2, nullptr);
+        tree.setProperty("third", 3, nullptr);
+        expectEquals(first.numCalls, 1);
+        expectEquals(second.numCalls, 1);
+
+        dispatcher->unsubscribe("first", first, jive::PropertyDispatcher::Scope::thisTreeOnly);
+        tree.setProperty("first", 4, nullptr);
+        expectEquals(first.numCalls, 1);
+
+        dispatcher->unsubscribe("second", second, jive::PropertyDispatcher::Scope::thisTreeOnly);
+    }
+
+    void testDescendants()
+    {
+        beginTest("descendants");
+
+        juce::ValueTree root{
+            "Root",
+            {},
+            {
+                juce::ValueTree{ "Child" },
+            },
+        };
+        auto dispatcher = jive::PropertyDispatcher::getDispatcherFor(root);
+
+        CountingSubscriber thisTreeOnly;
+        CountingSubscriber thisTreeAndDescendants;
+        dispatcher->subscribe("value", thisTreeOnly, jive::PropertyDispatcher::Scope::thisTreeOnly);
+        dispatcher->subscribe("value", thisTreeAndDescendants, jive::PropertyDispatcher::Scope::thisTreeAndDescendants);
+
+        root.getChild(0).setProperty("value", 1, nullptr);
+        expectEquals(thisTreeOnly.numCalls, 0);
+        expectEquals(thisTreeAndDescendants.numCalls, 1);
+
+        root.setProperty("value", 2, nullptr);
+        expectEquals(thisTreeOnly.numCalls, 1);
+        expectEquals(thisTreeAndDescendants.numCalls, 2);
+
+        dispatcher->unsubscribe("value", thisTreeOnly, jive::PropertyDispatcher::Scope::thisTreeOnly);
+        dispatcher->unsubscribe("value", thisTreeAndDescendants, jive::PropertyDispatcher::Scope::thisTreeAndDescendants);
+    }
+};
+
+static PropertyDispatcherUnitTest propertyDispatcherUnitTest;
+
+class PropertyDispatcherBenchmark : public juce::UnitTest
+{
+public:
+    PropertyDispatcherBenchmark()
+        : juce::UnitTest{ "jive::PropertyDispatcher", "jive-micro-benchmarks" }
+    {
+    }
+
+    void runTest() final
+    {
+        beginTest("per-write cost");
+
+        for (const auto numProperties : { 10, 40, 160 })
+        {
+            const auto listenerTime = measureWithValueTreeListeners(numProperties);
+            const auto dispatcherTime = measureWithDispatcher(numProperties);
+
+            logMessage(juce::String{ numProperties }
+                       + " properties on the written tree: "
+                       + juce::String{ listenerTime, 1 } + "ns per write with a listener per property, "
+                       + juce::String{ dispatcherTime, 1 } + "ns per write with a dispatcher");
+        }
+    }
+
+private:
+    static constexpr auto numWrites = 100000;
+
+    struct ListenerPerProperty : public juce::ValueTree::Listener
+    {
+        ListenerPerProperty(juce::ValueTree sourceTree, const juce::Identifier& propertyID)
+            : tree{ sourceTree }
+            , id{ propertyID }
+        {
+            tree.addListener(this);
+        }
+
+        void valueTreePropertyChanged(juce::ValueTree&, const juce::Identifier& property) final
+        {
+            if (property != id)
+                return;
+
+            numCalls++;
+        }
+
+        juce::ValueTree tree;
+        const juce::Identifier id;
+        int numCalls = 0;
+    };
+
+    template <typename WriteFunction>
+    static double measureNanosecondsPerWrite(WriteFunction&& write)
+    {
+        const auto start = juce::Time::getHighResolutionTicks();
+
+        for (auto i = 0; i < numWrites; i++)
+            write(i);
+
+        const auto seconds = juce::Time::highResolutionTicksToSeconds(juce::Time::getHighResolutionTicks() - start);
+        return seconds * 1.0e9 / numWrites;
+    }
+
+    static juce::Identifier getPropertyID(int index)
+    {
+        return "property-" + juce::String{ index };
+    }
+
+    double measureWithValueTreeListeners(int numProperties)
+    {
+        juce::ValueTree tree{ "Tree" };
+        std::vector<std::unique_ptr<ListenerPerProperty>> listeners;
+
+        for (auto i = 0; i < numProperties; i++)
+            listeners.push_back(std::make_unique<ListenerPerProperty>(tree, getPropertyID(i)));
+
+        const auto idToWrite = getPropertyID(0);
+        const auto time = measureNanosecondsPerWrite([&tree, &idToWrite](int value) {
+            tree.setProperty(idToWrite, value, nullptr);
+        });
+
+        expectEquals(listeners.front()->numCalls, numWrites);
+        return time;
+    }
+
+    double measureWithDispatcher(int numProperties)
+    {
+        juce::ValueTree tree{ "Tree" };
+        std::vector<std::unique_ptr<jive::Property<int>>> properties;
+        auto numCalls = 0;
+
+        for (auto i = 0; i < numProperties; i++)
+            properties.push_back(std::make_unique<jive::Property<int>>(tree, getPropertyID(i)));
+
+        properties.front()->onValueChange = [&numCalls]() {
+            numCalls++;
+        };
+
+        const auto idToWrite = getPropertyID(0);
+        const auto time = measureNanosecondsPerWrite([&tree, &idToWrite](int value) {
+            tree.setProperty(idToWrite, value, nullptr);
+        });
+
+        expectEquals(numCalls, numWrites);
+        return time;
+    }
+};
+
+static PropertyDispatcherBenchmark propertyDispatcherBenchmark;
+#endif
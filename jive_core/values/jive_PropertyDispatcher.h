@@ -0,0 +1,70 @@
+#pragma once
+
+namespace jive
+{
+    class PropertyDispatcher
+        : public juce::ReferenceCountedObject
+        , private juce::ValueTree::Listener
+    {
+    public:
+        using ReferenceCountedPointer = juce::ReferenceCountedObjectPtr<PropertyDispatcher>;
+
+        struct Subscriber
+        {
+            virtual ~Subscriber() = default;
+
+            virtual void valueTreePropertyChanged(juce::ValueTree& treeWhosePropertyChanged,
+                                                  const juce::Identifier& property) = 0;
+            virtual void valueTreeParentChanged(juce::ValueTree&) {}
+        };
+
+        enum class Scope
+        {
+            thisTreeOnly,
+            thisTreeAndDescendants,
+        };
+
+        ~PropertyDispatcher() override;
+
+        static ReferenceCountedPointer getDispatcherFor(const juce::ValueTree& tree);
+
+        void subscribe(const juce::Identifier& property, Subscriber& subscriber, Scope scope);
+        void unsubscribe(const juce::Identifier& property, Subscriber& subscriber, Scope scope);
+
+        const juce::ValueTree& getTree() const noexcept;
+
+        // The number of times the given property has changed on any tree with
+        // a subscriber for it, or any such tree has been moved to a new
+        // parent. Changes are counted as soon as they're made, even if their
+        // dispatch is deferred by a transaction.
+        static std::uint64_t getNumChanges(const juce::Identifier& property);
+
+    private:
+        friend class StateTransaction;
+
+        struct Route
+        {
+            juce::ListenerList<Subscriber> thisTree;
+            juce::ListenerList<Subscriber> descendants;
+            std::uint64_t* numChanges{ nullptr };
+        };
+
+        explicit PropertyDispatcher(const juce::ValueTree& treeToDispatchFor);
+
+        static std::unordered_map<const juce::NamedValueSet*, PropertyDispatcher*>& getDispatchers();
+        static std::unordered_map<juce::Identifier, std::uint64_t>& getChangeCounts();
+
+        void dispatch(juce::ValueTree& treeWhosePropertyChanged, const juce::Identifier& property);
+        void dispatch(Route& route, juce::ValueTree& treeWhosePropertyChanged, const juce::Identifier& property);
+
+        void valueTreePropertyChanged(juce::ValueTree& treeWhosePropertyChanged,
+                                      const juce::Identifier& property) final;
+        void valueTreeParentChanged(juce::ValueTree& treeWhoseParentChanged) final;
+
+        juce::ValueTree tree;
+        std::unordered_map<juce::Identifier, std::unique_ptr<Route>> routes;
+        int numDescendantSubscribers{ 0 };
+
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(PropertyDispatcher)
+    };
+} // namespace jive
@@ -0,0 +1,319 @@
+#include <jive_core/jive_core.h>
+
+namespace jive
+{
+    struct StateTransaction::Pending
+    {
+        struct PropertyChange
+        {
+            PropertyDispatcher::ReferenceCountedPointer dispatcher;
+            juce::ValueTree tree;
+            juce::Identifier property;
+        };
+
+        struct Call
+        {
+            const void* key;
+            std::uint64_t id;
+            int order;
+            std::function<void()> callback;
+        };
+
+        bool isDeferringCalls() const
+        {
+            return depth > 0 || isReplayingPropertyChanges;
+        }
+
+        int depth{ 0 };
+        bool isCommitting{ false };
+        bool isReplayingPropertyChanges{ false };
+
+        std::vector<PropertyChange> propertyChanges;
+        std::set<std::tuple<const void*, const void*, const void*>> queuedPropertyChanges;
+
+        // Each queued key maps to the ID of its call, so a call whose key was
+        // cancelled and then queued again isn't made twice.
+        std::vector<Call> calls;
+        std::unordered_map<const void*, std::uint64_t> queuedCalls;
+        std::uint64_t nextCallID{ 0 };
+    };
+
+    StateTransaction::StateTransaction()
+    {
+        JUCE_ASSERT_MESSAGE_THREAD
+
+        getPending().depth++;
+    }
+
+    StateTransaction::~StateTransaction()
+    {
+        JUCE_ASSERT_MESSAGE_THREAD
+
+        auto& pending = getPending();
+        jassert(pending.depth > 0);
+
+        if (--pending.depth == 0)
+            commit();
+    }
+
+    bool StateTransaction::isInProgress()
+    {
+        return getPending().depth > 0;
+    }
+
+    void StateTransaction::callWhenCommitted(const void* key, int order, std::function<void()> callback)
+    {
+        JUCE_ASSERT_MESSAGE_THREAD
+
+        auto& pending = getPending();
+
+        if (pending.queuedCalls.count(key) > 0)
+            return;
+
+        if (!pending.isDeferringCalls())
+        {
+            callback();
+            return;
+        }
+
+        const auto id = pending.nextCallID++;
+        pending.queuedCalls[key] = id;
+        pending.calls.push_back({ key, id, order, std::move(callback) });
+    }
+
+    void StateTransaction::cancelCall(const void* key)
+    {
+        JUCE_ASSERT_MESSAGE_THREAD
+
+        getPending().queuedCalls.erase(key);
+    }
+
+    StateTransaction::Pending& StateTransaction::getPending()
+    {
+        static Pending pending;
+        return pending;
+    }
+
+    bool StateTransaction::deferPropertyChange(PropertyDispatcher& dispatcher,
+                                               const juce::ValueTree& treeWhosePropertyChanged,
+                                               const juce::Identifier& property)
+    {
+        auto& pending = getPending();
+
+        if (pending.depth == 0)
+            return false;
+
+        const auto isNewChange = pending.queuedPropertyChanges
+                                     .emplace(&dispatcher,
+                                              &treeWhosePropertyChanged.getProperties(),
+                                              property.getCharPointer().getAddress())
+                                     .second;
+
+        if (isNewChange)
+            pending.propertyChanges.push_back({ &dispatcher, treeWhosePropertyChanged, property });
+
+        return true;
+    }
+
+    void StateTransaction::commit()
+    {
+        auto& pending = getPending();
+
+        // Transactions started from within the callbacks below are picked up
+        // by the loop rather than committing recursively.
+        if (pending.isCommitting)
+            return;
+
+        const juce::ScopedValueSetter<bool> committing{ pending.isCommitting, true };
+
+        while (!pending.propertyChanges.empty() || !pending.calls.empty())
+        {
+            {
+                const juce::ScopedValueSetter<bool> replaying{ pending.isReplayingPropertyChanges, true };
+
+                auto propertyChanges = std::move(pending.propertyChanges);
+                pending.propertyChanges.clear();
+                pending.queuedPropertyChanges.clear();
+
+                for (auto& change : propertyChanges)
+                    change.dispatcher->dispatch(change.tree, change.property);
+            }
+
+            auto calls = std::move(pending.calls);
+            pending.calls.clear();
+
+            std::stable_sort(std::begin(calls),
+                             std::end(calls),
+                             [](const auto& lhs, const auto& rhs) {
+                                 return lhs.order < rhs.order;
+                             });
+
+            for (const auto& call : calls)
+            {
+                const auto queued = pending.queuedCalls.find(call.key);
+
+                if (queued == std::end(pending.queuedCalls) || queued->second != call.id)
+                    continue;
+
+                pending.queuedCalls.erase(queued);
+                call.callback();
+            }
+        }
+    }
+} // namespace jive
+
+#if JIVE_UNIT_TESTS
+class StateTransactionUnitTest : public juce::UnitTest
+{
+public:
+    StateTransactionUnitTest()
+        : juce::UnitTest{ "jive::StateTransaction", "jive" }
+    {
+    }
+
+    void runTest() final
+    {
+        testDeferredCallbacks();
+        testNestedTransactions();
+        testCallsWhenCommitted();
+        testCancelledCalls();
+    }
+
+private:
+    void testDeferredCallbacks()
+    {
+        beginTest("deferred callbacks");
+
+        juce::ValueTree tree{ "Tree" };
+        jive::Property<int> value{ tree, "value" };
+        jive::Property<int> otherValue{ tree, "other-value" };
+
+        auto numCalls = 0;
+        value.onValueChange = [&numCalls]() {
+            numCalls++;
+        };
+        auto numOtherCalls = 0;
+        otherValue.onValueChange = [&numOtherCalls]() {
+            numOtherCalls++;
+        };
+
+        {
+            jive::StateTransaction transaction;
+            expect(jive::StateTransaction::isInProgress());
+
+            tree.setProperty("value", 1, nullptr);
+            tree.setProperty("value", 2, nullptr);
+            tree.setProperty("value", 3, nullptr);
+            tree.setProperty("other-value", 4, nullptr);
+            expectEquals(numCalls, 0);
+            expectEquals(numOtherCalls, 0);
+            expectEquals(value.get(), 3);
+        }
+
+        expect(!jive::StateTransaction::isInProgress());
+        expectEquals(numCalls, 1);
+        expectEquals(numOtherCalls, 1);
+
+        tree.setProperty("value", 5, nullptr);
+        expectEquals(numCalls, 2);
+    }
+
+    void testNestedTransactions()
+    {
+        beginTest("nested transactions");
+
+        juce::ValueTree tree{ "Tree" };
+        jive::Property<int> value{ tree, "value" };
+
+        auto numCalls = 0;
+        value.onValueChange = [&numCalls]() {
+            numCalls++;
+        };
+
+        {
+            jive::StateTransaction outer;
+            tree.setProperty("value", 1, nullptr);
+
+            {
+                jive::StateTransaction inner;
+                tree.setProperty("value", 2, nullptr);
+            }
+
+            expectEquals(numCalls, 0);
+        }
+
+        expectEquals(numCalls, 1);
+    }
+
+    void testCallsWhenCommitted()
+    {
+        beginTest("calls when committed");
+
+        juce::StringArray calls;
+        int first = 0;
+        int second = 0;
+
+        jive::StateTransaction::callWhenCommitted(&first, 0, [&calls]() {
+            calls.add("immediate");
+        });
+        expectEquals(calls.joinIntoString(","), juce::String{ "immediate" });
+        calls.clear();
+
+        {
+            jive::StateTransaction transaction;
+
+            jive::StateTransaction::callWhenCommitted(&second, 1, [&calls]() {
+                calls.add("second");
+            });
+            jive::StateTransaction::callWhenCommitted(&first, 0, [&calls]() {
+                calls.add("first");
+            });
+            jive::StateTransaction::callWhenCommitted(&second, 1, [&calls]() {
+                calls.add("second again");
+            });
+
+            expect(calls.isEmpty());
+        }
+
+        expectEquals(calls.joinIntoString(","), juce::String{ "first,second" });
+    }
+
+    void testCancelledCalls()
+    {
+        beginTest("cancelled calls");
+
+        juce::StringArray calls;
+        int key = 0;
+
+        {
+            jive::StateTransaction transaction;
+
+            jive::StateTransaction::callWhenCommitted(&key, 0, [&calls]() {
+                calls.add("destroyed owner");
+            });
+
+            // A new owner at the same address as one that was destroyed.
+            jive::StateTransaction::cancelCall(&key);
+            jive::StateTransaction::callWhenCommitted(&key, 0, [&calls]() {
+                calls.add("new owner");
+            });
+        }
+
+        expectEquals(calls.joinIntoString(","), juce::String{ "new owner" });
+        calls.clear();
+
+        {
+            jive::StateTransaction transaction;
+
+            jive::StateTransaction::callWhenCommitted(&key, 0, [&calls]() {
+                calls.add("cancelled");
+            });
+            jive::StateTransaction::cancelCall(&key);
+        }
+
+        expect(calls.isEmpty());
+    }
+};
+
+static StateTransactionUnitTest stateTransactionUnitTest;
+#endif
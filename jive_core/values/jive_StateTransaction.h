@@ -0,0 +1,32 @@
+#pragma once
+
+namespace jive
+{
+    class StateTransaction
+    {
+    public:
+        StateTransaction();
+        ~StateTransaction();
+
+        static bool isInProgress();
+        static void callWhenCommitted(const void* key, int order, std::function<void()> callback);
+
+        // Drops any call queued with the given key. Owners of a key should
+        // call this before they're destroyed, so that a new owner allocated at
+        // the same address isn't mistaken for the old one.
+        static void cancelCall(const void* key);
+
+    private:
+        friend class PropertyDispatcher;
+
+        struct Pending;
+
+        static Pending& getPending();
+        static bool deferPropertyChange(PropertyDispatcher& dispatcher,
+                                        const juce::ValueTree& treeWhosePropertyChanged,
+                                        const juce::Identifier& property);
+        static void commit();
+
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(StateTransaction)
+    };
+} // namespace jive
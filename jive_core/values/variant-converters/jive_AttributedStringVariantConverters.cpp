@@ -2,43 +2,47 @@
 
 namespace juce
 {
-    const Array<var> VariantConverter<AttributedString::ReadingDirection>::options = {
-        "natural",
-        "left-to-right",
-        "right-to-left",
-    };
+    static constexpr auto attributedStringReadingDirectionKeywords = jive::KeywordTable<AttributedString::ReadingDirection, 3>::sort({ {
+        { "natural", AttributedString::ReadingDirection::natural },
+        { "left-to-right", AttributedString::ReadingDirection::leftToRight },
+        { "right-to-left", AttributedString::ReadingDirection::rightToLeft },
+    } });
+
+    const jive::KeywordTable<AttributedString::ReadingDirection, 3> VariantConverter<AttributedString::ReadingDirection>::keywords{ attributedStringReadingDirectionKeywords };
 
     AttributedString::ReadingDirection VariantConverter<AttributedString::ReadingDirection>::fromVar(const var& v)
     {
-        jassert(options.contains(v));
-        return static_cast<AttributedString::ReadingDirection>(options.indexOf(v));
+        if (const auto value = keywords.find(v))
+            return *value;
+
+        jassertfalse;
+        return AttributedString::ReadingDirection::natural;
     }
 
     var VariantConverter<AttributedString::ReadingDirection>::toVar(const AttributedString::ReadingDirection& direction)
     {
-        const auto index = static_cast<int>(direction);
-
-        jassert(options.size() >= index);
-        return options[index];
+        return keywords.toVar(direction);
     }
 
-    const Array<var> VariantConverter<AttributedString::WordWrap>::options = {
-        "none",
-        "by-word",
-        "by-character",
-    };
+    static constexpr auto attributedStringWordWrapKeywords = jive::KeywordTable<AttributedString::WordWrap, 3>::sort({ {
+        { "none", AttributedString::WordWrap::none },
+        { "by-word", AttributedString::WordWrap::byWord },
+        { "by-character", AttributedString::WordWrap::byChar },
+    } });
+
+    const jive::KeywordTable<AttributedString::WordWrap, 3> VariantConverter<AttributedString::WordWrap>::keywords{ attributedStringWordWrapKeywords };
 
     AttributedString::WordWrap VariantConverter<AttributedString::WordWrap>::fromVar(const var& v)
     {
-        jassert(options.contains(v));
-        return static_cast<AttributedString::WordWrap>(options.indexOf(v));
+        if (const auto value = keywords.find(v))
+            return *value;
+
+        jassertfalse;
+        return AttributedString::WordWrap::byWord;
     }
 
     var VariantConverter<AttributedString::WordWrap>::toVar(const AttributedString::WordWrap& wordWrap)
     {
-        const auto index = static_cast<int>(wordWrap);
-
-        jassert(options.size() >= index);
-        return options[index];
+        return keywords.toVar(wordWrap);
     }
 } // namespace juce
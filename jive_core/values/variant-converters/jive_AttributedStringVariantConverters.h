@@ -10,7 +10,7 @@ namespace juce
         static var toVar(const AttributedString::ReadingDirection& direction);
 
     private:
-        static const Array<var> options;
+        static const jive::KeywordTable<AttributedString::ReadingDirection, 3> keywords;
     };
 
     template <>
@@ -21,6 +21,6 @@ namespace juce
         static var toVar(const AttributedString::WordWrap& wordWrap);
 
     private:
-        static const Array<var> options;
+        static const jive::KeywordTable<AttributedString::WordWrap, 3> keywords;
     };
 } // namespace juce
@@ -2,150 +2,162 @@
 
 namespace juce
 {
-    const Array<var> VariantConverter<FlexBox::AlignContent>::options = {
-        "stretch",
-        "flex-start",
-        "flex-end",
-        "centre",
-        "space-between",
-        "space-around"
-    };
+    static constexpr auto flexBoxAlignContentKeywords = jive::KeywordTable<FlexBox::AlignContent, 6>::sort({ {
+        { "stretch", FlexBox::AlignContent::stretch },
+        { "flex-start", FlexBox::AlignContent::flexStart },
+        { "flex-end", FlexBox::AlignContent::flexEnd },
+        { "centre", FlexBox::AlignContent::center },
+        { "space-between", FlexBox::AlignContent::spaceBetween },
+        { "space-around", FlexBox::AlignContent::spaceAround },
+    } });
+
+    const jive::KeywordTable<FlexBox::AlignContent, 6> VariantConverter<FlexBox::AlignContent>::keywords{ flexBoxAlignContentKeywords };
 
     FlexBox::AlignContent VariantConverter<FlexBox::AlignContent>::fromVar(const var& v)
     {
         if (v.isVoid())
             return FlexBox{}.alignContent;
 
-        jassert(options.contains(v));
-        return static_cast<FlexBox::AlignContent>(options.indexOf(v));
+        if (const auto value = keywords.find(v))
+            return *value;
+
+        jassertfalse;
+        return FlexBox{}.alignContent;
     }
 
     var VariantConverter<FlexBox::AlignContent>::toVar(FlexBox::AlignContent justification)
     {
-        const auto index = static_cast<int>(justification);
-
-        jassert(options.size() >= index);
-        return options[index];
+        return keywords.toVar(justification);
     }
 
-    const Array<var> VariantConverter<FlexBox::AlignItems>::options = {
-        "stretch",
-        "flex-start",
-        "flex-end",
-        "centre"
-    };
+    static constexpr auto flexBoxAlignItemsKeywords = jive::KeywordTable<FlexBox::AlignItems, 4>::sort({ {
+        { "stretch", FlexBox::AlignItems::stretch },
+        { "flex-start", FlexBox::AlignItems::flexStart },
+        { "flex-end", FlexBox::AlignItems::flexEnd },
+        { "centre", FlexBox::AlignItems::center },
+    } });
+
+    const jive::KeywordTable<FlexBox::AlignItems, 4> VariantConverter<FlexBox::AlignItems>::keywords{ flexBoxAlignItemsKeywords };
 
     FlexBox::AlignItems VariantConverter<FlexBox::AlignItems>::fromVar(const var& v)
     {
         if (v.isVoid())
             return FlexBox{}.alignItems;
 
-        jassert(options.contains(v));
-        return static_cast<FlexBox::AlignItems>(options.indexOf(v));
+        if (const auto value = keywords.find(v))
+            return *value;
+
+        jassertfalse;
+        return FlexBox{}.alignItems;
     }
 
     var VariantConverter<FlexBox::AlignItems>::toVar(FlexBox::AlignItems alignment)
     {
-        const auto index = static_cast<int>(alignment);
-
-        jassert(options.size() >= index);
-        return options[index];
+        return keywords.toVar(alignment);
     }
 
-    const Array<var> VariantConverter<FlexBox::Direction>::options = {
-        "row",
-        "row-reverse",
-        "column",
-        "column-reverse"
-    };
+    static constexpr auto flexBoxDirectionKeywords = jive::KeywordTable<FlexBox::Direction, 4>::sort({ {
+        { "row", FlexBox::Direction::row },
+        { "row-reverse", FlexBox::Direction::rowReverse },
+        { "column", FlexBox::Direction::column },
+        { "column-reverse", FlexBox::Direction::columnReverse },
+    } });
+
+    const jive::KeywordTable<FlexBox::Direction, 4> VariantConverter<FlexBox::Direction>::keywords{ flexBoxDirectionKeywords };
 
     FlexBox::Direction VariantConverter<FlexBox::Direction>::fromVar(const var& v)
     {
         if (v.isVoid())
             return FlexBox{}.flexDirection;
 
-        jassert(options.contains(v));
-        return static_cast<FlexBox::Direction>(options.indexOf(v));
+        if (const auto value = keywords.find(v))
+            return *value;
+
+        jassertfalse;
+        return FlexBox{}.flexDirection;
     }
 
     var VariantConverter<FlexBox::Direction>::toVar(FlexBox::Direction direction)
     {
-        const auto index = static_cast<int>(direction);
-
-        jassert(options.size() >= index);
-        return options[index];
+        return keywords.toVar(direction);
     }
 
-    const Array<var> VariantConverter<FlexBox::JustifyContent>::options = {
-        "flex-start",
-        "flex-end",
-        "centre",
-        "space-between",
-        "space-around"
-    };
+    static constexpr auto flexBoxJustifyContentKeywords = jive::KeywordTable<FlexBox::JustifyContent, 5>::sort({ {
+        { "flex-start", FlexBox::JustifyContent::flexStart },
+        { "flex-end", FlexBox::JustifyContent::flexEnd },
+        { "centre", FlexBox::JustifyContent::center },
+        { "space-between", FlexBox::JustifyContent::spaceBetween },
+        { "space-around", FlexBox::JustifyContent::spaceAround },
+    } });
+
+    const jive::KeywordTable<FlexBox::JustifyContent, 5> VariantConverter<FlexBox::JustifyContent>::keywords{ flexBoxJustifyContentKeywords };
 
     FlexBox::JustifyContent VariantConverter<FlexBox::JustifyContent>::fromVar(const var& v)
     {
         if (v.isVoid())
             return FlexBox{}.justifyContent;
 
-        jassert(options.contains(v));
-        return static_cast<FlexBox::JustifyContent>(options.indexOf(v));
+        if (const auto value = keywords.find(v))
+            return *value;
+
+        jassertfalse;
+        return FlexBox{}.justifyContent;
     }
 
     var VariantConverter<FlexBox::JustifyContent>::toVar(FlexBox::JustifyContent justification)
     {
-        const auto index = static_cast<int>(justification);
-
-        jassert(options.size() >= index);
-        return options[index];
+        return keywords.toVar(justification);
     }
 
-    const Array<var> VariantConverter<FlexBox::Wrap>::options = {
-        "nowrap",
-        "wrap",
-        "wrap-reverse"
-    };
+    static constexpr auto flexBoxWrapKeywords = jive::KeywordTable<FlexBox::Wrap, 3>::sort({ {
+        { "nowrap", FlexBox::Wrap::noWrap },
+        { "wrap", FlexBox::Wrap::wrap },
+        { "wrap-reverse", FlexBox::Wrap::wrapReverse },
+    } });
+
+    const jive::KeywordTable<FlexBox::Wrap, 3> VariantConverter<FlexBox::Wrap>::keywords{ flexBoxWrapKeywords };
 
     FlexBox::Wrap VariantConverter<FlexBox::Wrap>::fromVar(const var& v)
     {
         if (v.isVoid())
             return FlexBox{}.flexWrap;
 
-        jassert(options.contains(v));
-        return static_cast<FlexBox::Wrap>(options.indexOf(v));
+        if (const auto value = keywords.find(v))
+            return *value;
+
+        jassertfalse;
+        return FlexBox{}.flexWrap;
     }
 
     var VariantConverter<FlexBox::Wrap>::toVar(FlexBox::Wrap wrap)
     {
-        const auto index = static_cast<int>(wrap);
-
-        jassert(options.size() >= index);
-        return options[index];
+        return keywords.toVar(wrap);
     }
 
-    const Array<var> VariantConverter<FlexItem::AlignSelf>::options = {
-        "auto",
-        "flex-start",
-        "flex-end",
-        "centre",
-        "stretch"
-    };
+    static constexpr auto flexItemAlignSelfKeywords = jive::KeywordTable<FlexItem::AlignSelf, 5>::sort({ {
+        { "auto", FlexItem::AlignSelf::autoAlign },
+        { "flex-start", FlexItem::AlignSelf::flexStart },
+        { "flex-end", FlexItem::AlignSelf::flexEnd },
+        { "centre", FlexItem::AlignSelf::center },
+        { "stretch", FlexItem::AlignSelf::stretch },
+    } });
+
+    const jive::KeywordTable<FlexItem::AlignSelf, 5> VariantConverter<FlexItem::AlignSelf>::keywords{ flexItemAlignSelfKeywords };
 
     FlexItem::AlignSelf VariantConverter<FlexItem::AlignSelf>::fromVar(const var& v)
     {
         if (v.isVoid())
             return FlexItem{}.alignSelf;
 
-        jassert(options.contains(v));
-        return static_cast<FlexItem::AlignSelf>(options.indexOf(v));
+        if (const auto value = keywords.find(v))
+            return *value;
+
+        jassertfalse;
+        return FlexItem{}.alignSelf;
     }
 
     var VariantConverter<FlexItem::AlignSelf>::toVar(FlexItem::AlignSelf alignSelf)
     {
-        const auto index = static_cast<int>(alignSelf);
-
-        jassert(options.size() >= index);
-        return options[index];
+        return keywords.toVar(alignSelf);
     }
 } // namespace juce
@@ -9,7 +9,7 @@ namespace juce
         static var toVar(FlexBox::AlignContent direction);
 
     private:
-        static const Array<var> options;
+        static const jive::KeywordTable<FlexBox::AlignContent, 6> keywords;
     };
 
     template <>
@@ -19,7 +19,7 @@ namespace juce
         static var toVar(FlexBox::AlignItems direction);
 
     private:
-        static const Array<var> options;
+        static const jive::KeywordTable<FlexBox::AlignItems, 4> keywords;
     };
 
     template <>
@@ -29,7 +29,7 @@ namespace juce
         static var toVar(FlexBox::Direction direction);
 
     private:
-        static const Array<var> options;
+        static const jive::KeywordTable<FlexBox::Direction, 4> keywords;
     };
 
     template <>
@@ -39,7 +39,7 @@ namespace juce
         static var toVar(FlexBox::JustifyContent direction);
 
     private:
-        static const Array<var> options;
+        static const jive::KeywordTable<FlexBox::JustifyContent, 5> keywords;
     };
 
     template <>
@@ -49,7 +49,7 @@ namespace juce
         static var toVar(FlexBox::Wrap direction);
 
     private:
-        static const Array<var> options;
+        static const jive::KeywordTable<FlexBox::Wrap, 3> keywords;
     };
 
     template <>
@@ -59,6 +59,6 @@ namespace juce
         static var toVar(FlexItem::AlignSelf alignSelf);
 
     private:
-        static const Array<var> options;
+        static const jive::KeywordTable<FlexItem::AlignSelf, 5> keywords;
     };
 } // namespace juce
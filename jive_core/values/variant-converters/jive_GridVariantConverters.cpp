@@ -2,48 +2,52 @@
 
 namespace juce
 {
-    const Array<var> VariantConverter<GridItem::JustifySelf>::options = {
-        "start",
-        "end",
-        "centre",
-        "stretch",
-        "auto"
-    };
+    static constexpr auto gridItemJustifySelfKeywords = jive::KeywordTable<GridItem::JustifySelf, 5>::sort({ {
+        { "start", GridItem::JustifySelf::start },
+        { "end", GridItem::JustifySelf::end },
+        { "centre", GridItem::JustifySelf::center },
+        { "stretch", GridItem::JustifySelf::stretch },
+        { "auto", GridItem::JustifySelf::autoValue },
+    } });
+
+    const jive::KeywordTable<GridItem::JustifySelf, 5> VariantConverter<GridItem::JustifySelf>::keywords{ gridItemJustifySelfKeywords };
 
     GridItem::JustifySelf VariantConverter<GridItem::JustifySelf>::fromVar(const var& v)
     {
-        jassert(options.contains(v));
-        return static_cast<GridItem::JustifySelf>(options.indexOf(v));
+        if (const auto value = keywords.find(v))
+            return *value;
+
+        jassertfalse;
+        return GridItem::JustifySelf::autoValue;
     }
 
     var VariantConverter<GridItem::JustifySelf>::toVar(GridItem::JustifySelf justification)
     {
-        const auto index = static_cast<int>(justification);
-
-        jassert(options.size() >= index);
-        return options[index];
+        return keywords.toVar(justification);
     }
 
-    const Array<var> VariantConverter<GridItem::AlignSelf>::options = {
-        "start",
-        "end",
-        "centre",
-        "stretch",
-        "auto"
-    };
+    static constexpr auto gridItemAlignSelfKeywords = jive::KeywordTable<GridItem::AlignSelf, 5>::sort({ {
+        { "start", GridItem::AlignSelf::start },
+        { "end", GridItem::AlignSelf::end },
+        { "centre", GridItem::AlignSelf::center },
+        { "stretch", GridItem::AlignSelf::stretch },
+        { "auto", GridItem::AlignSelf::autoValue },
+    } });
+
+    const jive::KeywordTable<GridItem::AlignSelf, 5> VariantConverter<GridItem::AlignSelf>::keywords{ gridItemAlignSelfKeywords };
 
     GridItem::AlignSelf VariantConverter<GridItem::AlignSelf>::fromVar(const var& v)
     {
-        jassert(options.contains(v));
-        return static_cast<GridItem::AlignSelf>(options.indexOf(v));
+        if (const auto value = keywords.find(v))
+            return *value;
+
+        jassertfalse;
+        return GridItem::AlignSelf::autoValue;
     }
 
     var VariantConverter<GridItem::AlignSelf>::toVar(GridItem::AlignSelf alignment)
     {
-        const auto index = static_cast<int>(alignment);
-
-        jassert(options.size() >= index);
-        return options[index];
+        return keywords.toVar(alignment);
     }
 
     GridItem::Span VariantConverter<GridItem::Span>::fromVar(const var& v)
@@ -125,115 +129,125 @@ namespace juce
         return tokens.joinIntoString(" / ");
     }
 
-    const Array<var> VariantConverter<Grid::JustifyItems>::options = {
-        "start",
-        "end",
-        "centre",
-        "stretch",
-    };
+    static constexpr auto gridJustifyItemsKeywords = jive::KeywordTable<Grid::JustifyItems, 4>::sort({ {
+        { "start", Grid::JustifyItems::start },
+        { "end", Grid::JustifyItems::end },
+        { "centre", Grid::JustifyItems::center },
+        { "stretch", Grid::JustifyItems::stretch },
+    } });
+
+    const jive::KeywordTable<Grid::JustifyItems, 4> VariantConverter<Grid::JustifyItems>::keywords{ gridJustifyItemsKeywords };
 
     Grid::JustifyItems VariantConverter<Grid::JustifyItems>::fromVar(const var& v)
     {
-        jassert(options.contains(v));
-        return static_cast<Grid::JustifyItems>(options.indexOf(v));
+        if (const auto value = keywords.find(v))
+            return *value;
+
+        jassertfalse;
+        return Grid::JustifyItems::stretch;
     }
 
     var VariantConverter<Grid::JustifyItems>::toVar(Grid::JustifyItems justification)
     {
-        const auto index = static_cast<int>(justification);
-
-        jassert(options.size() >= index);
-        return options[index];
+        return keywords.toVar(justification);
     }
 
-    const Array<var> VariantConverter<Grid::AlignItems>::options = {
-        "start",
-        "end",
-        "centre",
-        "stretch",
-    };
+    static constexpr auto gridAlignItemsKeywords = jive::KeywordTable<Grid::AlignItems, 4>::sort({ {
+        { "start", Grid::AlignItems::start },
+        { "end", Grid::AlignItems::end },
+        { "centre", Grid::AlignItems::center },
+        { "stretch", Grid::AlignItems::stretch },
+    } });
+
+    const jive::KeywordTable<Grid::AlignItems, 4> VariantConverter<Grid::AlignItems>::keywords{ gridAlignItemsKeywords };
 
     Grid::AlignItems VariantConverter<Grid::AlignItems>::fromVar(const var& v)
     {
-        jassert(options.contains(v));
-        return static_cast<Grid::AlignItems>(options.indexOf(v));
+        if (const auto value = keywords.find(v))
+            return *value;
+
+        jassertfalse;
+        return Grid::AlignItems::stretch;
     }
 
     var VariantConverter<Grid::AlignItems>::toVar(Grid::AlignItems alignment)
     {
-        const auto index = static_cast<int>(alignment);
-
-        jassert(options.size() >= index);
-        return options[index];
+        return keywords.toVar(alignment);
     }
 
-    const Array<var> VariantConverter<Grid::JustifyContent>::options = {
-        "start",
-        "end",
-        "centre",
-        "stretch",
-        "space-around",
-        "space-between",
-        "space-evenly",
-    };
+    static constexpr auto gridJustifyContentKeywords = jive::KeywordTable<Grid::JustifyContent, 7>::sort({ {
+        { "start", Grid::JustifyContent::start },
+        { "end", Grid::JustifyContent::end },
+        { "centre", Grid::JustifyContent::center },
+        { "stretch", Grid::JustifyContent::stretch },
+        { "space-around", Grid::JustifyContent::spaceAround },
+        { "space-between", Grid::JustifyContent::spaceBetween },
+        { "space-evenly", Grid::JustifyContent::spaceEvenly },
+    } });
+
+    const jive::KeywordTable<Grid::JustifyContent, 7> VariantConverter<Grid::JustifyContent>::keywords{ gridJustifyContentKeywords };
 
     Grid::JustifyContent VariantConverter<Grid::JustifyContent>::fromVar(const var& v)
     {
-        jassert(options.contains(v));
-        return static_cast<Grid::JustifyContent>(options.indexOf(v));
+        if (const auto value = keywords.find(v))
+            return *value;
+
+        jassertfalse;
+        return Grid::JustifyContent::stretch;
     }
 
     var VariantConverter<Grid::JustifyContent>::toVar(Grid::JustifyContent justification)
     {
-        const auto index = static_cast<int>(justification);
-
-        jassert(options.size() >= index);
-        return options[index];
+        return keywords.toVar(justification);
     }
 
-    const Array<var> VariantConverter<Grid::AlignContent>::options = {
-        "start",
-        "end",
-        "centre",
-        "stretch",
-        "space-around",
-        "space-between",
-        "space-evenly",
-    };
+    static constexpr auto gridAlignContentKeywords = jive::KeywordTable<Grid::AlignContent, 7>::sort({ {
+        { "start", Grid::AlignContent::start },
+        { "end", Grid::AlignContent::end },
+        { "centre", Grid::AlignContent::center },
+        { "stretch", Grid::AlignContent::stretch },
+        { "space-around", Grid::AlignContent::spaceAround },
+        { "space-between", Grid::AlignContent::spaceBetween },
+        { "space-evenly", Grid::AlignContent::spaceEvenly },
+    } });
+
+    const jive::KeywordTable<Grid::AlignContent, 7> VariantConverter<Grid::AlignContent>::keywords{ gridAlignContentKeywords };
 
     Grid::AlignContent VariantConverter<Grid::AlignContent>::fromVar(const var& v)
     {
-        jassert(options.contains(v));
-        return static_cast<Grid::AlignContent>(options.indexOf(v));
+        if (const auto value = keywords.find(v))
+            return *value;
+
+        jassertfalse;
+        return Grid::AlignContent::stretch;
     }
 
     var VariantConverter<Grid::AlignContent>::toVar(Grid::AlignContent alignment)
     {
-        const auto index = static_cast<int>(alignment);
-
-        jassert(options.size() >= index);
-        return options[index];
+        return keywords.toVar(alignment);
     }
 
-    const Array<var> VariantConverter<Grid::AutoFlow>::options = {
-        "row",
-        "column",
-        "row dense",
-        "column dense",
-    };
+    static constexpr auto gridAutoFlowKeywords = jive::KeywordTable<Grid::AutoFlow, 4>::sort({ {
+        { "row", Grid::AutoFlow::row },
+        { "column", Grid::AutoFlow::column },
+        { "row dense", Grid::AutoFlow::rowDense },
+        { "column dense", Grid::AutoFlow::columnDense },
+    } });
+
+    const jive::KeywordTable<Grid::AutoFlow, 4> VariantConverter<Grid::AutoFlow>::keywords{ gridAutoFlowKeywords };
 
     Grid::AutoFlow VariantConverter<Grid::AutoFlow>::fromVar(const var& v)
     {
-        jassert(options.contains(v));
-        return static_cast<Grid::AutoFlow>(options.indexOf(v));
+        if (const auto value = keywords.find(v))
+            return *value;
+
+        jassertfalse;
+        return Grid::AutoFlow::row;
     }
 
     var VariantConverter<Grid::AutoFlow>::toVar(Grid::AutoFlow flow)
     {
-        const auto index = static_cast<int>(flow);
-
-        jassert(options.size() >= index);
-        return options[index];
+        return keywords.toVar(flow);
     }
 
     Grid::TrackInfo VariantConverter<Grid::TrackInfo>::fromVar(const var& v)
@@ -9,7 +9,7 @@ namespace juce
         static var toVar(GridItem::JustifySelf justification);
 
     private:
-        static const Array<var> options;
+        static const jive::KeywordTable<GridItem::JustifySelf, 5> keywords;
     };
 
     template <>
@@ -19,7 +19,7 @@ namespace juce
         static var toVar(GridItem::AlignSelf alignment);
 
     private:
-        static const Array<var> options;
+        static const jive::KeywordTable<GridItem::AlignSelf, 5> keywords;
     };
 
     template <>
@@ -50,7 +50,7 @@ namespace juce
         static var toVar(Grid::JustifyItems justification);
 
     private:
-        static const Array<var> options;
+        static const jive::KeywordTable<Grid::JustifyItems, 4> keywords;
     };
 
     template <>
@@ -60,7 +60,7 @@ namespace juce
         static var toVar(Grid::AlignItems alignment);
 
     private:
-        static const Array<var> options;
+        static const jive::KeywordTable<Grid::AlignItems, 4> keywords;
     };
 
     template <>
@@ -70,7 +70,7 @@ namespace juce
         static var toVar(Grid::JustifyContent alignment);
 
     private:
-        static const Array<var> options;
+        static const jive::KeywordTable<Grid::JustifyContent, 7> keywords;
     };
 
     template <>
@@ -80,7 +80,7 @@ namespace juce
         static var toVar(Grid::AlignContent alignment);
 
     private:
-        static const Array<var> options;
+        static const jive::KeywordTable<Grid::AlignContent, 7> keywords;
     };
 
     template <>
@@ -90,7 +90,7 @@ namespace juce
         static var toVar(Grid::AutoFlow flow);
 
     private:
-        static const Array<var> options;
+        static const jive::KeywordTable<Grid::AutoFlow, 4> keywords;
     };
 
     template <>
@@ -0,0 +1,188 @@
+#include <jive_core/jive_core.h>
+
+#if JIVE_UNIT_TESTS
+class KeywordTableUnitTest : public juce::UnitTest
+{
+public:
+    KeywordTableUnitTest()
+        : juce::UnitTest{ "jive::KeywordTable", "jive" }
+    {
+    }
+
+    void runTest() final
+    {
+        testLookUp();
+        testInternedStrings();
+        testConverters();
+    }
+
+private:
+    enum class Fruit
+    {
+        apple,
+        banana,
+        cherry,
+    };
+
+    using FruitTable = jive::KeywordTable<Fruit, 3>;
+
+    static constexpr FruitTable::Keywords fruits{ {
+        { "cherry", Fruit::cherry },
+        { "apple", Fruit::apple },
+        { "banana", Fruit::banana },
+    } };
+
+    static constexpr auto sortedFruits = FruitTable::sort(fruits);
+
+    static_assert(!FruitTable::isSorted(fruits));
+    static_assert(FruitTable::isSorted(sortedFruits));
+    static_assert(FruitTable::find(sortedFruits, "banana") == Fruit::banana);
+    static_assert(!FruitTable::find(sortedFruits, "durian").has_value());
+
+    void testLookUp()
+    {
+        beginTest("look-up");
+
+        const FruitTable table{ sortedFruits };
+        expect(table.find(juce::var{ "apple" }) == Fruit::apple);
+        expect(table.find(juce::var{ "banana" }) == Fruit::banana);
+        expect(table.find(juce::var{ "cherry" }) == Fruit::cherry);
+        expect(!table.find(juce::var{ "Apple" }).has_value());
+        expect(!table.find(juce::var{ "" }).has_value());
+        expect(!table.find(juce::var{}).has_value());
+        expect(!table.find(juce::var{ 1 }).has_value());
+        expect(table.find(std::string_view{ "cherry" }) == Fruit::cherry);
+    }
+
+    void testInternedStrings()
+    {
+        beginTest("interned strings");
+
+        const FruitTable table{ sortedFruits };
+        const auto interned = table.toVar(Fruit::banana);
+        expectEquals(interned.toString(), juce::String{ "banana" });
+        expect(interned.toString().getCharPointer().getAddress()
+               == table.toVar(Fruit::banana).toString().getCharPointer().getAddress());
+        expect(table.find(interned) == Fruit::banana);
+
+        const juce::Identifier identifier{ "cherry" };
+        expect(table.find(juce::var{ identifier.toString() }) == Fruit::cherry);
+
+        const auto notInterned = juce::String{ "ban" } + "ana";
+        expect(table.find(juce::var{ notInterned }) == Fruit::banana);
+    }
+
+    void testConverters()
+    {
+        beginTest("converters");
+
+        expect(juce::VariantConverter<juce::FlexBox::Direction>::fromVar("column-reverse")
+               == juce::FlexBox::Direction::columnReverse);
+        expect(juce::VariantConverter<juce::FlexBox::Direction>::fromVar(juce::var{})
+               == juce::FlexBox{}.flexDirection);
+        expect(juce::VariantConverter<juce::Grid::AutoFlow>::fromVar("column dense")
+               == juce::Grid::AutoFlow::columnDense);
+        expect(juce::VariantConverter<juce::Justification>::fromVar("bottom-left")
+               == juce::Justification::bottomLeft);
+        expect(juce::VariantConverter<juce::Justification>::fromVar("not-a-justification")
+               == juce::Justification::centred);
+        expectEquals(juce::VariantConverter<juce::Justification>::toVar(juce::Justification::centredTop).toString(),
+                     juce::String{ "centred-top" });
+        expect(juce::VariantConverter<juce::Justification>::toVar(juce::Justification::left).isVoid());
+        expect(juce::VariantConverter<juce::Justification>::toVar(juce::Justification::left | juce::Justification::bottom).isVoid());
+
+        for (const auto cursor : { juce::MouseCursor::ParentCursor,
+                                   juce::MouseCursor::IBeamCursor,
+                                   juce::MouseCursor::BottomRightCornerResizeCursor })
+        {
+            const auto v = juce::VariantConverter<juce::MouseCursor::StandardCursorType>::toVar(cursor);
+            expect(juce::VariantConverter<juce::MouseCursor::StandardCursorType>::fromVar(v) == cursor);
+        }
+
+        expect(juce::VariantConverter<juce::RectanglePlacement>::fromVar("centred")
+               == juce::RectanglePlacement{ juce::RectanglePlacement::centred });
+        expect(juce::VariantConverter<juce::RectanglePlacement>::fromVar("  left\ttop  reduce-only")
+               == juce::RectanglePlacement{ juce::RectanglePlacement::xLeft
+                                            | juce::RectanglePlacement::yTop
+                                            | juce::RectanglePlacement::onlyReduceInSize });
+    }
+};
+
+static KeywordTableUnitTest keywordTableUnitTest;
+
+class KeywordTableBenchmark : public juce::UnitTest
+{
+public:
+    KeywordTableBenchmark()
+        : juce::UnitTest{ "jive::KeywordTable", "jive-micro-benchmarks" }
+    {
+    }
+
+    void runTest() final
+    {
+        beginTest("mouse-cursor parse cost");
+
+        using Converter = juce::VariantConverter<juce::MouseCursor::StandardCursorType>;
+
+        // The last keyword is the worst case for a linear search.
+        const auto interned = Converter::toVar(juce::MouseCursor::BottomRightCornerResizeCursor);
+        const juce::var notInterned{ juce::String{ "down-" } + "right" };
+        const juce::Array<juce::var> options{
+            "inherit",
+            "none",
+            "default",
+            "wait",
+            "text",
+            "crosshair",
+            "copy",
+            "pointer",
+            "grab",
+            "left-right",
+            "up-down",
+            "move",
+            "up",
+            "down",
+            "left",
+            "right",
+            "up-left",
+            "up-right",
+            "down-left",
+            "down-right",
+        };
+
+        const auto linearTime = measureNanosecondsPerParse([&options, &notInterned]() {
+            return options.indexOf(notInterned);
+        });
+        const auto searchTime = measureNanosecondsPerParse([&notInterned]() {
+            return static_cast<int>(Converter::fromVar(notInterned));
+        });
+        const auto internedTime = measureNanosecondsPerParse([&interned]() {
+            return static_cast<int>(Converter::fromVar(interned));
+        });
+
+        logMessage(juce::String{ linearTime, 1 } + "ns per parse with Array<var>::indexOf(), "
+                   + juce::String{ searchTime, 1 } + "ns with a sorted keyword table, "
+                   + juce::String{ internedTime, 1 } + "ns with an interned string");
+    }
+
+private:
+    static constexpr auto numParses = 1000000;
+
+    template <typename ParseFunction>
+    double measureNanosecondsPerParse(ParseFunction&& parse)
+    {
+        auto checksum = 0;
+        const auto start = juce::Time::getHighResolutionTicks();
+
+        for (auto i = 0; i < numParses; i++)
+            checksum += parse();
+
+        const auto seconds = juce::Time::highResolutionTicksToSeconds(juce::Time::getHighResolutionTicks() - start);
+        expectEquals(checksum / numParses, static_cast<int>(juce::MouseCursor::BottomRightCornerResizeCursor));
+
+        return seconds * 1.0e9 / numParses;
+    }
+};
+
+static KeywordTableBenchmark keywordTableBenchmark;
+#endif
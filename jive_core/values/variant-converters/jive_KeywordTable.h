@@ -0,0 +1,139 @@
+#pragma once
+
+namespace jive
+{
+    template <typename Value, std::size_t numKeywords>
+    class KeywordTable
+    {
+    public:
+        struct Keyword
+        {
+            std::string_view text;
+            Value value;
+        };
+
+        using Keywords = std::array<Keyword, numKeywords>;
+
+        // The keywords should already be sorted, which can be done when
+        // they're compiled by declaring them with constexpr and sort().
+        explicit KeywordTable(const Keywords& sortedKeywords)
+            : keywords{ sortedKeywords }
+        {
+            jassert(isSorted(keywords));
+
+            for (std::size_t i = 0; i < numKeywords; i++)
+            {
+                const auto& text = keywords[i].text;
+                internedKeywords[i] = juce::StringPool::getGlobalPool()
+                                          .getPooledString(juce::String::fromUTF8(text.data(),
+                                                                                  static_cast<int>(text.size())));
+            }
+        }
+
+        std::optional<Value> find(const juce::var& v) const
+        {
+            if (!v.isString())
+                return std::nullopt;
+
+            const auto text = v.toString();
+
+            // Strings written by toVar(), or taken from an Identifier, share
+            // their storage with the pooled keyword so can be matched on
+            // their address alone.
+            const auto* const address = text.getCharPointer().getAddress();
+
+            for (std::size_t i = 0; i < numKeywords; i++)
+            {
+                if (internedKeywords[i].getCharPointer().getAddress() == address)
+                    return keywords[i].value;
+            }
+
+            return find(std::string_view{ text.toRawUTF8() });
+        }
+
+        std::optional<Value> find(std::string_view text) const
+        {
+            return find(keywords, text);
+        }
+
+        juce::var toVar(Value value) const
+        {
+            const auto keyword = findKeyword(value);
+            jassert(!keyword.isVoid());
+
+            return keyword;
+        }
+
+        // Like toVar(), but quietly returns an empty var for values that
+        // have no keyword.
+        juce::var findKeyword(Value value) const
+        {
+            for (std::size_t i = 0; i < numKeywords; i++)
+            {
+                if (keywords[i].value == value)
+                    return internedKeywords[i];
+            }
+
+            return {};
+        }
+
+        const Keywords& getKeywords() const noexcept
+        {
+            return keywords;
+        }
+
+        static constexpr Keywords sort(Keywords keywordsToSort)
+        {
+            for (std::size_t i = 1; i < numKeywords; i++)
+            {
+                for (auto j = i; j > 0 && keywordsToSort[j].text < keywordsToSort[j - 1].text; j--)
+                {
+                    const auto previous = keywordsToSort[j - 1];
+                    keywordsToSort[j - 1] = keywordsToSort[j];
+                    keywordsToSort[j] = previous;
+                }
+            }
+
+            return keywordsToSort;
+        }
+
+        static constexpr bool isSorted(const Keywords& keywordsToCheck)
+        {
+            for (std::size_t i = 1; i < numKeywords; i++)
+            {
+                if (keywordsToCheck[i].text < keywordsToCheck[i - 1].text)
+                    return false;
+            }
+
+            return true;
+        }
+
+        static constexpr std::optional<Value> find(const Keywords& sortedKeywords, std::string_view text)
+        {
+            std::size_t low = 0;
+            auto high = numKeywords;
+
+            while (low < high)
+            {
+                const auto middle = low + (high - low) / 2;
+                const auto comparison = text.compare(sortedKeywords[middle].text);
+
+                if (comparison == 0)
+                    return sortedKeywords[middle].value;
+
+                if (comparison < 0)
+                    high = middle;
+                else
+                    low = middle + 1;
+            }
+
+            return std::nullopt;
+        }
+
+    private:
+        const Keywords keywords;
+        std::array<juce::String, numKeywords> internedKeywords;
+
+        JUCE_LEAK_DETECTOR(KeywordTable)
+    };
+} // namespace jive
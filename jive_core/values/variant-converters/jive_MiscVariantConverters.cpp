@@ -2,52 +2,30 @@
 
 namespace juce
 {
+    static constexpr auto justificationKeywords = jive::KeywordTable<Justification::Flags, 9>::sort({ {
+        { "centred-left", Justification::centredLeft },
+        { "top-left", Justification::topLeft },
+        { "centred-top", Justification::centredTop },
+        { "top-right", Justification::topRight },
+        { "centred-right", Justification::centredRight },
+        { "bottom-right", Justification::bottomRight },
+        { "centred-bottom", Justification::centredBottom },
+        { "bottom-left", Justification::bottomLeft },
+        { "centred", Justification::centred },
+    } });
+
+    const jive::KeywordTable<Justification::Flags, 9> VariantConverter<Justification>::keywords{ justificationKeywords };
+
     Justification VariantConverter<Justification>::fromVar(const var& v)
     {
-        if (v == "centred-left")
-            return Justification::centredLeft;
-        else if (v == "top-left")
-            return Justification::topLeft;
-        else if (v == "centred-top")
-            return Justification::centredTop;
-        else if (v == "top-right")
-            return Justification::topRight;
-        else if (v == "centred-right")
-            return Justification::centredRight;
-        else if (v == "bottom-right")
-            return Justification::bottomRight;
-        else if (v == "centred-bottom")
-            return Justification::centredBottom;
-        else if (v == "bottom-left")
-            return Justification::bottomLeft;
-        else if (v == "centred")
-            return Justification::centred;
-
-        return Justification::centred;
+        return keywords.find(v).value_or(Justification::centred);
     }
 
     var VariantConverter<Justification>::toVar(Justification justification)
     {
-        if (justification == Justification::centredLeft)
-            return "centred-left";
-        else if (justification == Justification::topLeft)
-            return "top-left";
-        else if (justification == Justification::centredTop)
-            return "centred-top";
-        else if (justification == Justification::topRight)
-            return "top-right";
-        else if (justification == Justification::centredRight)
-            return "centred-right";
-        else if (justification == Justification::bottomRight)
-            return "bottom-right";
-        else if (justification == Justification::centredBottom)
-            return "centred-bottom";
-        else if (justification == Justification::bottomLeft)
-            return "bottom-left";
-        else if (justification == Justification::centred)
-            return "centred";
-
-        return {};
+        // Combinations of flags that have no keyword, like left on its own,
+        // are written as an empty var.
+        return keywords.findKeyword(static_cast<Justification::Flags>(justification.getFlags()));
     }
 
     Identifier VariantConverter<Identifier>::fromVar(const var& v)
@@ -63,41 +41,43 @@ namespace juce
         return { id.toString() };
     }
 
-    const Array<var> VariantConverter<MouseCursor::StandardCursorType>::options = {
-        "inherit",
-        "none",
-        "default",
-        "wait",
-        "text",
-        "crosshair",
-        "copy",
-        "pointer",
-        "grab",
-        "left-right",
-        "up-down",
-        "move",
-        "up",
-        "down",
-        "left",
-        "right",
-        "up-left",
-        "up-right",
-        "down-left",
-        "down-right"
-    };
+    static constexpr auto mouseCursorStandardCursorTypeKeywords = jive::KeywordTable<MouseCursor::StandardCursorType, 20>::sort({ {
+        { "inherit", MouseCursor::ParentCursor },
+        { "none", MouseCursor::NoCursor },
+        { "default", MouseCursor::NormalCursor },
+        { "wait", MouseCursor::WaitCursor },
+        { "text", MouseCursor::IBeamCursor },
+        { "crosshair", MouseCursor::CrosshairCursor },
+        { "copy", MouseCursor::CopyingCursor },
+        { "pointer", MouseCursor::PointingHandCursor },
+        { "grab", MouseCursor::DraggingHandCursor },
+        { "left-right", MouseCursor::LeftRightResizeCursor },
+        { "up-down", MouseCursor::UpDownResizeCursor },
+        { "move", MouseCursor::UpDownLeftRightResizeCursor },
+        { "up", MouseCursor::TopEdgeResizeCursor },
+        { "down", MouseCursor::BottomEdgeResizeCursor },
+        { "left", MouseCursor::LeftEdgeResizeCursor },
+        { "right", MouseCursor::RightEdgeResizeCursor },
+        { "up-left", MouseCursor::TopLeftCornerResizeCursor },
+        { "up-right", MouseCursor::TopRightCornerResizeCursor },
+        { "down-left", MouseCursor::BottomLeftCornerResizeCursor },
+        { "down-right", MouseCursor::BottomRightCornerResizeCursor },
+    } });
+
+    const jive::KeywordTable<MouseCursor::StandardCursorType, 20> VariantConverter<MouseCursor::StandardCursorType>::keywords{ mouseCursorStandardCursorTypeKeywords };
 
     MouseCursor::StandardCursorType VariantConverter<MouseCursor::StandardCursorType>::fromVar(const var& v)
     {
-        jassert(options.contains(v));
-        return static_cast<MouseCursor::StandardCursorType>(options.indexOf(v));
+        if (const auto value = keywords.find(v))
+            return *value;
+
+        jassertfalse;
+        return MouseCursor::NormalCursor;
     }
 
     var VariantConverter<MouseCursor::StandardCursorType>::toVar(MouseCursor::StandardCursorType cursor)
     {
-        const auto index = static_cast<int>(cursor);
-
-        jassert(options.size() >= index);
-        return options[index];
+        return keywords.toVar(cursor);
     }
 
     StringArray VariantConverter<StringArray>::fromVar(const var& v)
@@ -176,7 +156,7 @@ namespace juce
         return var{ image.getPixelData() };
     }
 
-    const std::unordered_map<String, RectanglePlacement::Flags> VariantConverter<RectanglePlacement>::map = {
+    static constexpr auto rectanglePlacementKeywords = jive::KeywordTable<RectanglePlacement::Flags, 12>::sort({ {
         { "left", RectanglePlacement::xLeft },
         { "right", RectanglePlacement::xRight },
         { "centred-x", RectanglePlacement::xMid },
@@ -189,30 +169,50 @@ namespace juce
         { "increase-only", RectanglePlacement::onlyIncreaseInSize },
         { "do-not-resize", RectanglePlacement::doNotResize },
         { "centred", RectanglePlacement::centred },
-    };
+    } });
+
+    const jive::KeywordTable<RectanglePlacement::Flags, 12> VariantConverter<RectanglePlacement>::keywords{ rectanglePlacementKeywords };
 
     RectanglePlacement VariantConverter<RectanglePlacement>::fromVar(const var& v)
     {
-        const auto tokens = StringArray::fromTokens(v.toString(), false);
-        return std::accumulate(std::begin(tokens),
-                               std::end(tokens),
-                               0,
-                               [](const auto& flags, const auto& token) {
-                                   jassert(map.count(token) > 0);
-                                   return flags + map.at(token);
-                               });
+        if (const auto flags = keywords.find(v))
+            return *flags;
+
+        static constexpr std::string_view whitespace{ " \t\r\n" };
+
+        const auto text = v.toString();
+        std::string_view remaining{ text.toRawUTF8() };
+        auto flags = 0;
+
+        while (!remaining.empty())
+        {
+            const auto tokenStart = remaining.find_first_not_of(whitespace);
+
+            if (tokenStart == std::string_view::npos)
+                break;
+
+            remaining.remove_prefix(tokenStart);
+            const auto token = remaining.substr(0, remaining.find_first_of(whitespace));
+            remaining.remove_prefix(token.size());
+
+            const auto flag = keywords.find(token);
+            jassert(flag.has_value());
+            flags += flag.value_or(0);
+        }
+
+        return flags;
     }
 
     var VariantConverter<RectanglePlacement>::toVar(const RectanglePlacement& placement)
     {
-        auto stringFlagPair = std::find_if(std::begin(map),
-                                           std::end(map),
-                                           [&placement](const auto& pair) {
-                                               return placement.testFlags(pair.second);
-                                           });
-        jassert(stringFlagPair != std::end(map));
-
-        return stringFlagPair->first;
+        for (const auto& keyword : keywords.getKeywords())
+        {
+            if (placement.testFlags(keyword.value))
+                return keywords.toVar(keyword.value);
+        }
+
+        jassertfalse;
+        return {};
     }
 
     StringArray getTokensBetweenParentheses(const String& text)
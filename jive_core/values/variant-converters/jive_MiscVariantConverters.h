@@ -7,6 +7,9 @@ namespace juce
     {
         static Justification fromVar(const var& v);
         static var toVar(Justification justification);
+
+    private:
+        static const jive::KeywordTable<Justification::Flags, 9> keywords;
     };
 
     template <typename ValueType>
@@ -75,7 +78,7 @@ namespace juce
         static var toVar(MouseCursor::StandardCursorType cursor);
 
     private:
-        static const Array<var> options;
+        static const jive::KeywordTable<MouseCursor::StandardCursorType, 20> keywords;
     };
 
     template <typename T>
@@ -166,7 +169,7 @@ namespace juce
         static var toVar(const RectanglePlacement& placement);
 
     private:
-        static const std::unordered_map<String, RectanglePlacement::Flags> map;
+        static const jive::KeywordTable<RectanglePlacement::Flags, 12> keywords;
     };
 
     template <>
@@ -3,6 +3,7 @@
 #include "utilities/jive_ComponentFactory.cpp"
 #include "utilities/jive_Display.cpp"
 #include "utilities/jive_Drawable.cpp"
+#include "utilities/jive_LayoutRules.cpp"
 #include "utilities/jive_Overflow.cpp"
 
 #include "layout/gui-items/jive_GuiItem.cpp"
@@ -31,3 +32,6 @@
 #include "layout/gui-items/widgets/jive_Spinner.cpp"
 
 #include "layout/jive_Interpreter.cpp"
+#include "layout/jive_LayoutScheduler.cpp"
+#include "layout/jive_ParallelMeasurer.cpp"
+#include "layout/jive_HeadlessLayout.cpp"
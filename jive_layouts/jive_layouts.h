@@ -31,6 +31,7 @@ namespace jive
 #include "utilities/jive_Display.h"
 #include "utilities/jive_Drawable.h"
 #include "utilities/jive_LayoutStrategy.h"
+#include "utilities/jive_LayoutRules.h"
 #include "utilities/jive_Overflow.h"
 
 #include "layout/gui-items/jive_GuiItem.h"
@@ -59,3 +60,6 @@ namespace jive
 #include "layout/gui-items/widgets/jive_Spinner.h"
 
 #include "layout/jive_Interpreter.h"
+#include "layout/jive_LayoutScheduler.h"
+#include "layout/jive_ParallelMeasurer.h"
+#include "layout/jive_HeadlessLayout.h"
@@ -11,10 +11,14 @@ namespace jive
 
     void BlockContainer::layOutChildren()
     {
+        JIVE_LAYOUT_STATS_SCOPE(layOutChildren, state);
+
+        const auto contentBounds = BoxModelView{ state }.getContentBounds();
+
         for (auto child : getChildren())
         {
             auto& blockItem = *dynamic_cast<GuiItemDecorator&>(*child).toType<BlockItem>();
-            child->getComponent()->setBounds(blockItem.calculateBounds());
+            child->getComponent()->setBounds(blockItem.calculateBounds(contentBounds));
         }
     }
 
@@ -33,45 +33,31 @@ namespace jive
         getComponent()->setBounds(calculateBounds());
     }
 
-    int BlockItem::calculateX() const
+    juce::Rectangle<int> BlockItem::calculateBounds() const
     {
-        const auto parentContentBounds = BoxModel{ state.getParent() }.getContentBounds();
-
-        if (centreX.exists())
-            return juce::roundToInt(centreX.toPixels(parentContentBounds) - boxModel.getWidth() / 2.f);
-
-        return juce::roundToInt(x.toPixels(parentContentBounds));
+        return calculateBounds(BoxModelView{ state.getParent() }.getContentBounds());
     }
 
-    int BlockItem::calculateY() const
+    juce::Rectangle<int> BlockItem::calculateBounds(juce::Rectangle<float> parentContentBounds) const
     {
-        const auto parentContentBounds = BoxModel{ state.getParent() }.getContentBounds();
+        BlockItemValues values;
 
+        if (x.exists())
+            values.x = x.toPixels(parentContentBounds);
+        if (y.exists())
+            values.y = y.toPixels(parentContentBounds);
+        if (centreX.exists())
+            values.centreX = centreX.toPixels(parentContentBounds);
         if (centreY.exists())
-            return juce::roundToInt(centreY.toPixels(parentContentBounds) - boxModel.getHeight() / 2.f);
-
-        return juce::roundToInt(y.toPixels(parentContentBounds));
-    }
-
-    juce::Rectangle<int> BlockItem::calculateBounds() const
-    {
-        juce::Rectangle<int> bounds;
-        const auto& parentBoxModel = dynamic_cast<const GuiItemDecorator*>(getParent())->toType<CommonGuiItem>()->boxModel;
-        const auto parentBounds = parentBoxModel.getContentBounds();
-
+            values.centreY = centreY.toPixels(parentContentBounds);
         if (!width.isAuto())
-            bounds.setWidth(juce::roundToInt(width.toPixels(parentBounds)));
+            values.width = width.toPixels(parentContentBounds);
         if (!height.isAuto())
-            bounds.setHeight(juce::roundToInt(height.toPixels(parentBounds)));
-
-        return bounds.withPosition(parentBoxModel
-                                       .getContentBounds()
-                                       .getPosition()
-                                       .roundToInt()
-                                   + juce::Point{
-                                       calculateX(),
-                                       calculateY(),
-                                   });
+            values.height = height.toPixels(parentContentBounds);
+
+        values.size = { boxModel.getWidth(), boxModel.getHeight() };
+
+        return calculateBlockItemBounds(values, parentContentBounds);
     }
 } // namespace jive
 
@@ -89,6 +75,7 @@ public:
         testPosition();
         testCentre();
         testSize();
+        testParentIsReadOnly();
     }
 
 private:
@@ -304,7 +291,126 @@ private:
         parentState.getChild(0).setProperty("height", 20.89f, nullptr);
         expectEquals(item.getComponent()->getHeight(), 21);
     }
+
+    void testParentIsReadOnly()
+    {
+        beginTest("parent is read-only");
+
+        struct ChangeCounter : public juce::ValueTree::Listener
+        {
+            explicit ChangeCounter(const juce::ValueTree& treeToWatch)
+                : tree{ treeToWatch }
+            {
+            }
+
+            void valueTreePropertyChanged(juce::ValueTree& changedTree, const juce::Identifier&) final
+            {
+                if (changedTree == tree)
+                    numChanges++;
+            }
+
+            juce::ValueTree tree;
+            int numChanges = 0;
+        };
+
+        juce::ValueTree parentState{
+            "Component",
+            {
+                { "display", "block" },
+                { "width", 300 },
+                { "height", 200 },
+                { "padding", "5 10" },
+            },
+            {
+                juce::ValueTree{ "Component" },
+            },
+        };
+        jive::Interpreter interpreter;
+        const auto parent = interpreter.interpret(parentState);
+        auto& item = *parent->getChildren()[0];
+
+        ChangeCounter counter{ parentState };
+        parentState.addListener(&counter);
+
+        parentState.getChild(0).setProperty("x", "50%", nullptr);
+        parentState.getChild(0).setProperty("centre-y", 40, nullptr);
+        expectEquals(counter.numChanges, 0);
+        expectEquals(item.getComponent()->getX(), 150);
+        expectEquals(item.getComponent()->getY(), 45);
+
+        parentState.removeListener(&counter);
+    }
 };
 
 static BlockItemTest blockItemTest;
+
+class BlockItemBenchmark : public juce::UnitTest
+{
+public:
+    BlockItemBenchmark()
+        : juce::UnitTest{ "jive::BlockItem", "jive-micro-benchmarks" }
+    {
+    }
+
+    void runTest() final
+    {
+        beginTest("move one of 10k block items");
+
+        juce::ValueTree state{
+            "Component",
+            {
+                { "display", "block" },
+                { "width", 4000 },
+                { "height", 4000 },
+                { "padding", 10 },
+                { "border-width", 2 },
+            },
+        };
+
+        for (auto i = 0; i < numItems; i++)
+        {
+            state.appendChild(juce::ValueTree{
+                                  "Component",
+                                  {
+                                      { "x", (i % 100) * 40 },
+                                      { "y", (i / 100) * 40 },
+                                      { "width", 30 },
+                                      { "height", 30 },
+                                  },
+                              },
+                              nullptr);
+        }
+
+        jive::Interpreter interpreter;
+        std::unique_ptr<jive::GuiItem> item;
+
+        {
+            jive::StateTransaction transaction;
+            item = interpreter.interpret(state);
+        }
+
+        auto node = state.getChild(numItems / 2);
+        const auto start = juce::Time::getHighResolutionTicks();
+
+        for (auto move = 0; move < numMoves; move++)
+        {
+            node.setProperty("x", move % 1000, nullptr);
+            node.setProperty("y", (move * 7) % 1000, nullptr);
+        }
+
+        const auto seconds = juce::Time::highResolutionTicksToSeconds(juce::Time::getHighResolutionTicks() - start);
+        logMessage(juce::String{ seconds * 1.0e6 / numMoves, 2 } + "us per move of one of "
+                   + juce::String{ numItems } + " block items");
+
+        const auto& component = *item->getChildren()[numItems / 2]->getComponent();
+        expectEquals(component.getX(), 12 + (numMoves - 1) % 1000);
+        expectEquals(component.getY(), 12 + ((numMoves - 1) * 7) % 1000);
+    }
+
+private:
+    static constexpr auto numItems = 10000;
+    static constexpr auto numMoves = 10000;
+};
+
+static BlockItemBenchmark blockItemBenchmark;
 #endif
@@ -8,11 +8,9 @@ namespace jive
         explicit BlockItem(std::unique_ptr<GuiItem> itemToDecorate);
 
         juce::Rectangle<int> calculateBounds() const;
+        juce::Rectangle<int> calculateBounds(juce::Rectangle<float> parentContentBounds) const;
 
     private:
-        int calculateX() const;
-        int calculateY() const;
-
         Length x;
         Length y;
         Length centreX;
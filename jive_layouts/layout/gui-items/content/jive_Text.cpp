@@ -31,7 +31,7 @@ namespace jive
         state.setProperty("ideal-height",
                           juce::var{ [this](const juce::var::NativeFunctionArgs& args) {
                               const auto layout = buildTextLayout(args.arguments[0]);
-                              return std::ceil(layout.getHeight());
+                              return std::ceil(layout->getHeight());
                           } },
                           nullptr);
 
@@ -75,8 +75,10 @@ namespace jive
         updateTextComponent();
     }
 
-    juce::TextLayout Text::buildTextLayout(float maxWidth) const
+    std::shared_ptr<const juce::TextLayout> Text::buildTextLayout(float maxWidth) const
     {
+        JIVE_LAYOUT_STATS_SCOPE(buildTextLayout, state);
+
         for (auto* parentItem = getParent();
              maxWidth < 0.0f && parentItem != nullptr;
              parentItem = parentItem->getParent())
@@ -88,10 +90,7 @@ namespace jive
             }
         }
 
-        juce::TextLayout layout;
-        layout.createLayout(getTextComponent().getAttributedString(), maxWidth);
-
-        return layout;
+        return TextLayoutCache::getLayout(getTextComponent().getAttributedString(), maxWidth);
     }
 
     void Text::updateTextComponent()
@@ -119,15 +118,43 @@ namespace jive
             }
         }
 
-        idealWidth = std::ceil(buildTextLayout(std::numeric_limits<float>::max())
-                                   .getWidth());
+        // Laying out the text is by far the most expensive part of creating
+        // it, so it's left to the measurer, which lays out text created within
+        // a transaction on several threads at once.
+        TextLayoutCache::resolveTypefaces(getTextComponent().getAttributedString());
+        ParallelMeasurer::measure(this,
+                                  [attributedString = getTextComponent().getAttributedString(),
+                                   safeThis = juce::WeakReference<GuiItem>{ this }]() -> ParallelMeasurer::Apply {
+                                      const auto layout = TextLayoutCache::getLayout(attributedString,
+                                                                                     std::numeric_limits<float>::max());
+                                      const auto width = std::ceil(layout->getWidth());
+
+                                      return [safeThis, width]() {
+                                          if (auto* textItem = dynamic_cast<Text*>(safeThis.get()))
+                                              textItem->applyIdealWidth(width);
+                                      };
+                                  });
+    }
+
+    void Text::applyIdealWidth(float width)
+    {
+        idealWidth = width;
 
         if (auto* parentItem = getParent())
         {
+            const auto* const commonItem = toType<CommonGuiItem>();
+
             if (!parentItem->isContainer())
+            {
                 getTextComponent().setAccessible(false);
-            else
+            }
+            else if (commonItem == nullptr || !commonItem->boxModel.isRelayoutBoundary())
+            {
+                if (auto* container = dynamic_cast<GuiItemDecorator*>(parentItem)->toType<ContainerItem>())
+                    container->invalidateIdealSize();
+
                 parentItem->state.setProperty("box-model-valid", false, nullptr);
+            }
         }
     }
 
@@ -166,6 +193,7 @@ public:
         testLineSpacing();
         testNested();
         testAutoSize();
+        testSharedLayouts();
     }
 
 private:
@@ -577,6 +605,36 @@ private:
             }
         }
     }
+
+    void testSharedLayouts()
+    {
+        beginTest("shared layouts");
+
+        jive::TextLayoutCache::clear();
+
+        juce::ValueTree state{
+            "Component",
+            {
+                { "width", 300 },
+                { "height", 300 },
+                { "align-items", "flex-start" },
+            },
+        };
+
+        for (auto i = 0; i < 10; i++)
+            state.appendChild(juce::ValueTree{ "Text", { { "text", "Mute" } } }, nullptr);
+
+        jive::Interpreter interpreter;
+        auto item = interpreter.interpret(state);
+
+        // Every label is the same, so the text is only laid out once for each
+        // width it's measured at.
+        const auto statistics = jive::TextLayoutCache::getStatistics();
+        expectGreaterThan(statistics.hits, statistics.misses);
+        expectLessThan(statistics.numLayouts, 10);
+        expectEquals(item->getChildren()[9]->getComponent()->getWidth(),
+                     item->getChildren()[0]->getComponent()->getWidth());
+    }
 };
 
 static TextTest textTest;
@@ -21,9 +21,10 @@ namespace jive
     private:
         void textFontChanged(TextComponent& text) final;
 
-        juce::TextLayout buildTextLayout(float maxWidth = -1.0f) const;
+        std::shared_ptr<const juce::TextLayout> buildTextLayout(float maxWidth = -1.0f) const;
 
         void updateTextComponent();
+        void applyIdealWidth(float width);
 
         Property<juce::String> text;
         Property<float, HereditaryValueBehaviour::inheritFromAncestors> lineSpacing;
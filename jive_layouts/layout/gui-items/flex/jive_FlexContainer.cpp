@@ -31,14 +31,23 @@ namespace jive
         };
     }
 
+    void FlexContainer::addChild(std::unique_ptr<GuiItem> child)
+    {
+        retainedItemsNeedRebuilding = true;
+        ContainerItem::addChild(std::move(child));
+    }
+
     void FlexContainer::layOutChildren()
     {
+        JIVE_LAYOUT_STATS_SCOPE(layOutChildren, state);
+
         const auto bounds = boxModel.getContentBounds();
 
         if (bounds.getWidth() <= 0 || bounds.getHeight() <= 0)
             return;
 
-        buildFlexBox(bounds, LayoutStrategy::real).performLayout(bounds);
+        updateRetainedFlexBox(bounds);
+        retainedFlexBox.performLayout(bounds);
     }
 
     FlexContainer::operator juce::FlexBox()
@@ -48,51 +57,12 @@ namespace jive
 
     juce::Rectangle<float> FlexContainer::calculateIdealSize(juce::Rectangle<float> constraints) const
     {
-        switch (flexDirection.getOr(juce::FlexBox{}.flexDirection))
-        {
-        case juce::FlexBox::Direction::column:
-        case juce::FlexBox::Direction::columnReverse:
-            constraints.setHeight(std::numeric_limits<float>::max());
-            break;
-        case juce::FlexBox::Direction::row:
-        case juce::FlexBox::Direction::rowReverse:
-            constraints.setWidth(std::numeric_limits<float>::max());
-            break;
-        default:
-            jassertfalse;
-        }
+        constraints = getFlexIdealSizeConstraints(flexDirection.getOr(juce::FlexBox{}.flexDirection), constraints);
 
         const auto flex = const_cast<FlexContainer&>(*this)
                               .buildFlexBox(constraints, LayoutStrategy::dummy);
-        juce::Point<float> extremities{ -1.0f, -1.0f };
 
-        for (const auto& flexItem : flex.items)
-        {
-            const auto right = flexItem.currentBounds.getRight() + flexItem.margin.right;
-            const auto bottom = flexItem.currentBounds.getBottom() + flexItem.margin.bottom;
-
-            if (right > extremities.x)
-                extremities.x = right;
-            if (bottom > extremities.y)
-                extremities.y = bottom;
-        }
-
-        return {
-            extremities.x
-                + boxModel
-                      .getPadding()
-                      .getLeftAndRight()
-                + boxModel
-                      .getBorder()
-                      .getLeftAndRight(),
-            extremities.y
-                + boxModel
-                      .getPadding()
-                      .getTopAndBottom()
-                + boxModel
-                      .getBorder()
-                      .getTopAndBottom(),
-        };
+        return calculateSizeToFit(flex.items, boxModel.getPadding(), boxModel.getBorder());
     }
 
     void appendChildren(GuiItem& container,
@@ -110,37 +80,86 @@ namespace jive
         }
     }
 
-    juce::FlexBox FlexContainer::buildFlexBox(juce::Rectangle<float> bounds,
-                                              LayoutStrategy strategy)
+    void FlexContainer::updateRetainedFlexBox(juce::Rectangle<float> bounds)
     {
-        juce::FlexBox flex;
+        auto items = std::move(retainedFlexBox.items);
+        retainedFlexBox = createFlexBox(getValues(), LayoutStrategy::real);
+        retainedFlexBox.items = std::move(items);
 
-        flex.flexDirection = flexDirection;
-        flex.flexWrap = flexWrap;
+        const auto isInColumn = state.getProperty("flex-direction").toString().contains("column");
 
-        appendChildren(*this, flex, bounds, strategy);
-
-        switch (strategy)
+        if (retainedItemsNeedRebuilding)
         {
-        case LayoutStrategy::real:
-            flex.justifyContent = flexJustifyContent;
-            flex.alignItems = flexAlignItems;
-            flex.alignContent = flexAlignContent;
-            break;
-        case LayoutStrategy::dummy:
-            flex.justifyContent = juce::FlexBox::JustifyContent::flexStart;
-            flex.alignItems = juce::FlexBox::AlignItems::flexStart;
-            flex.alignContent = juce::FlexBox::AlignContent::flexStart;
+            retainedItems.clear();
+            retainedFlexBox.items.clearQuick();
 
-            flex.performLayout(bounds);
+            for (auto* child : getChildren())
+            {
+                if (auto* const decoratedItem = dynamic_cast<GuiItemDecorator*>(child))
+                {
+                    if (auto* const flexItem = decoratedItem->toType<FlexItem>())
+                    {
+                        flexItem->syncRevision();
+                        retainedItems.push_back({ flexItem, flexItem->getRevision() });
+                        retainedFlexBox.items.add(flexItem->toJuceFlexItem(bounds, LayoutStrategy::real, isInColumn));
+                    }
+                }
+            }
 
-            break;
-        default:
-            jassertfalse;
+            retainedItemsNeedRebuilding = false;
         }
+        else
+        {
+            const auto boundsChanged = bounds != retainedBounds;
+            const auto directionChanged = isInColumn != retainedItemsAreInColumn;
+
+            for (std::size_t i = 0; i < retainedItems.size(); i++)
+            {
+                auto& retainedItem = retainedItems[i];
+                auto& flexItem = *retainedItem.item;
+                flexItem.syncRevision();
+
+                if (directionChanged
+                    || retainedItem.revision != flexItem.getRevision()
+                    || flexItem.hasComputedIdealHeight()
+                    || (boundsChanged && flexItem.dependsOnParentBounds()))
+                {
+                    retainedItem.revision = flexItem.getRevision();
+                    retainedFlexBox.items.getReference(static_cast<int>(i)) = flexItem.toJuceFlexItem(bounds,
+                                                                                                     LayoutStrategy::real,
+                                                                                                     isInColumn);
+                }
+            }
+        }
+
+        retainedBounds = bounds;
+        retainedItemsAreInColumn = isInColumn;
+    }
+
+    juce::FlexBox FlexContainer::buildFlexBox(juce::Rectangle<float> bounds,
+                                              LayoutStrategy strategy)
+    {
+        auto flex = createFlexBox(getValues(), strategy);
+        appendChildren(*this, flex, bounds, strategy);
+
+        if (strategy == LayoutStrategy::dummy)
+            flex.performLayout(bounds);
 
         return flex;
     }
+
+    FlexContainerValues FlexContainer::getValues() const
+    {
+        FlexContainerValues values;
+
+        values.direction = flexDirection;
+        values.wrap = flexWrap;
+        values.justifyContent = flexJustifyContent;
+        values.alignItems = flexAlignItems;
+        values.alignContent = flexAlignContent;
+
+        return values;
+    }
 } // namespace jive
 
 #if JIVE_UNIT_TESTS
@@ -163,6 +182,7 @@ public:
         testPadding();
         testAutoSize();
         testNestedWidgetWithText();
+        testRetainedLayout();
     }
 
 private:
@@ -548,7 +568,150 @@ private:
             expectEquals(jive::BoxModel{ container.state }.getHeight(), std::ceil(layout.getHeight()));
         }
     }
+
+    void expectSameLayoutAsFreshFlexBox(jive::FlexContainer& item)
+    {
+        juce::Array<juce::Rectangle<int>> retainedBounds;
+
+        for (auto* child : item.getChildren())
+            retainedBounds.add(child->getComponent()->getBounds());
+
+        const auto contentBounds = jive::BoxModel{ item.state }.getContentBounds();
+        static_cast<juce::FlexBox>(item).performLayout(contentBounds);
+
+        for (auto i = 0; i < retainedBounds.size(); i++)
+            expect(item.getChildren()[i]->getComponent()->getBounds() == retainedBounds[i]);
+    }
+
+    void testRetainedLayout()
+    {
+        beginTest("retained layout");
+
+        juce::ValueTree tree{
+            "Component",
+            {
+                { "width", 300 },
+                { "height", 200 },
+                { "align-items", "flex-start" },
+            },
+        };
+
+        for (auto i = 0; i < 3; i++)
+        {
+            tree.appendChild(juce::ValueTree{
+                                 "Component",
+                                 {
+                                     { "width", 50 },
+                                     { "height", 20 },
+                                 },
+                             },
+                             nullptr);
+        }
+
+        auto item = createFlexContainer(tree);
+        expectEquals(item->getChildren()[2]->getComponent()->getY(), 40);
+        expectSameLayoutAsFreshFlexBox(*item);
+
+        tree.getChild(0).setProperty("height", 30, nullptr);
+        expectEquals(item->getChildren()[2]->getComponent()->getY(), 50);
+        expectSameLayoutAsFreshFlexBox(*item);
+
+        tree.getChild(1).setProperty("margin", "5 0 5 0", nullptr);
+        expectEquals(item->getChildren()[2]->getComponent()->getY(), 60);
+        expectSameLayoutAsFreshFlexBox(*item);
+
+        tree.getChild(1).setProperty("flex-grow", 1, nullptr);
+        expectEquals(item->getChildren()[1]->getComponent()->getHeight(), 140);
+        expectEquals(item->getChildren()[2]->getComponent()->getY(), 180);
+        expectSameLayoutAsFreshFlexBox(*item);
+
+        tree.getChild(2).setProperty("width", "50%", nullptr);
+        expectEquals(item->getChildren()[2]->getComponent()->getWidth(), 150);
+        tree.setProperty("width", 400, nullptr);
+        expectEquals(item->getChildren()[2]->getComponent()->getWidth(), 200);
+        expectSameLayoutAsFreshFlexBox(*item);
+
+        tree.setProperty("flex-direction", "row", nullptr);
+        expectEquals(item->getChildren()[1]->getComponent()->getX(), 50);
+        expectSameLayoutAsFreshFlexBox(*item);
+    }
 };
 
 static FlexContainerUnitTest flexContainerUnitTest;
+
+class FlexContainerBenchmark : public juce::UnitTest
+{
+public:
+    FlexContainerBenchmark()
+        : juce::UnitTest{ "jive::FlexContainer", "jive-micro-benchmarks" }
+    {
+    }
+
+    void runTest() final
+    {
+        beginTest("5k item flex column");
+
+        juce::ValueTree state{
+            "Component",
+            {
+                { "width", 400 },
+                { "height", 200000 },
+                { "align-items", "flex-start" },
+            },
+        };
+
+        for (auto i = 0; i < numItems; i++)
+        {
+            state.appendChild(juce::ValueTree{
+                                  "Component",
+                                  {
+                                      { "width", 100 },
+                                      { "height", 20 },
+                                  },
+                              },
+                              nullptr);
+        }
+
+        jive::Interpreter interpreter;
+        std::unique_ptr<jive::GuiItem> item;
+
+        {
+            jive::StateTransaction transaction;
+            item = interpreter.interpret(state);
+        }
+
+        auto& container = *dynamic_cast<jive::GuiItemDecorator&>(*item).toType<jive::FlexContainer>();
+        const auto contentBounds = jive::BoxModel{ state }.getContentBounds();
+
+        const auto rebuiltSeconds = measureSecondsPerLayout([&container, contentBounds]() {
+            static_cast<juce::FlexBox>(container).performLayout(contentBounds);
+        });
+        const auto retainedSeconds = measureSecondsPerLayout([&item]() {
+            item->layOutChildren();
+        });
+
+        logMessage(juce::String{ rebuiltSeconds * 1000.0, 3 } + "ms per layout of "
+                   + juce::String{ numItems } + " items rebuilding the flex box, "
+                   + juce::String{ retainedSeconds * 1000.0, 3 } + "ms retaining it");
+
+        expectEquals(item->getChildren()[numItems - 1]->getComponent()->getY(), (numItems - 1) * 20);
+    }
+
+private:
+    template <typename LayoutFunction>
+    double measureSecondsPerLayout(LayoutFunction&& layOut)
+    {
+        const auto start = juce::Time::getHighResolutionTicks();
+
+        for (auto pass = 0; pass < numPasses; pass++)
+            layOut();
+
+        return juce::Time::highResolutionTicksToSeconds(juce::Time::getHighResolutionTicks() - start) / numPasses;
+    }
+
+    static constexpr auto numItems = 5000;
+    static constexpr auto numPasses = 20;
+};
+
+static FlexContainerBenchmark flexContainerBenchmark;
 #endif
@@ -7,6 +7,7 @@ namespace jive
     public:
         explicit FlexContainer(std::unique_ptr<GuiItem> itemToDecorate);
 
+        void addChild(std::unique_ptr<GuiItem> child) override;
         void layOutChildren() override;
 
         operator juce::FlexBox();
@@ -15,16 +16,32 @@ namespace jive
         juce::Rectangle<float> calculateIdealSize(juce::Rectangle<float> constraints) const override;
 
     private:
+        struct RetainedItem
+        {
+            FlexItem* item;
+            juce::uint32 revision;
+        };
+
         juce::FlexBox buildFlexBox(juce::Rectangle<float> bounds, LayoutStrategy strategy);
+        void updateRetainedFlexBox(juce::Rectangle<float> bounds);
+        FlexContainerValues getValues() const;
 
-        Property<juce::FlexBox::Direction> flexDirection;
-        Property<juce::FlexBox::Wrap> flexWrap;
-        Property<juce::FlexBox::JustifyContent> flexJustifyContent;
-        Property<juce::FlexBox::AlignItems> flexAlignItems;
-        Property<juce::FlexBox::AlignContent> flexAlignContent;
+        CachedProperty<juce::FlexBox::Direction> flexDirection;
+        CachedProperty<juce::FlexBox::Wrap> flexWrap;
+        CachedProperty<juce::FlexBox::JustifyContent> flexJustifyContent;
+        CachedProperty<juce::FlexBox::AlignItems> flexAlignItems;
+        CachedProperty<juce::FlexBox::AlignContent> flexAlignContent;
 
         const BoxModel& boxModel;
 
+        // The flex box used for real layouts is kept between passes, with
+        // only the items whose inputs have changed being rebuilt.
+        juce::FlexBox retainedFlexBox;
+        std::vector<RetainedItem> retainedItems;
+        juce::Rectangle<float> retainedBounds;
+        bool retainedItemsAreInColumn{ false };
+        bool retainedItemsNeedRebuilding{ true };
+
         JUCE_LEAK_DETECTOR(FlexContainer)
     };
 } // namespace jive
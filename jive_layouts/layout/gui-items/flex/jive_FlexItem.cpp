@@ -20,132 +20,123 @@ namespace jive
         jassert(getParent() != nullptr);
 
         const auto updateParentLayout = [this]() {
-            getParent()->layOutChildren();
+            revision++;
+
+            if (auto* container = dynamic_cast<GuiItemDecorator*>(getParent())->toType<ContainerItem>())
+                container->invalidateIdealSize();
+
+            getParent()->requestLayout();
         };
         order.onValueChange = updateParentLayout;
         flexGrow.onValueChange = updateParentLayout;
         flexShrink.onValueChange = updateParentLayout;
         flexBasis.onValueChange = updateParentLayout;
         alignSelf.onValueChange = updateParentLayout;
+        minWidth.onValueChange = updateParentLayout;
+        minHeight.onValueChange = updateParentLayout;
     }
 
-    juce::FlexItem::Margin transform(const juce::BorderSize<float>& border)
+    juce::FlexItem FlexItem::toJuceFlexItem(juce::Rectangle<float> parentContentBounds,
+                                            LayoutStrategy strategy) const
     {
-        return juce::FlexItem::Margin{
-            border.getTop(),
-            border.getRight(),
-            border.getBottom(),
-            border.getLeft()
+        return toJuceFlexItem(parentContentBounds,
+                              strategy,
+                              state.getParent().getProperty("flex-direction").toString().contains("column"));
+    }
+
+    void FlexItem::syncRevision()
+    {
+        static const std::array<juce::Identifier, numBoxModelSources> boxModelProperties{
+            "width",
+            "height",
+            "ideal-width",
+            "ideal-height",
+            "margin",
         };
+
+        // The box model re-lays out the parent as soon as any of these
+        // change, which can be before this item has been notified, so they're
+        // compared with the values last seen rather than listened to.
+        for (std::size_t i = 0; i < numBoxModelSources; i++)
+        {
+            const auto* const source = state.getPropertyPointer(boxModelProperties[i]);
+            const auto value = source != nullptr ? *source : juce::var{};
+
+            if (!isSameSource(boxModelSources[i], value))
+            {
+                boxModelSources[i] = value;
+                revision++;
+            }
+        }
+    }
+
+    juce::uint32 FlexItem::getRevision() const
+    {
+        return revision;
+    }
+
+    bool FlexItem::dependsOnParentBounds() const
+    {
+        return width.isPercent()
+            || height.isPercent()
+            || minWidth.isPercent()
+            || minHeight.isPercent()
+            || idealWidth.exists()
+            || idealHeight.exists();
+    }
+
+    bool FlexItem::hasComputedIdealHeight() const
+    {
+        return state["ideal-height"].isMethod();
     }
 
     juce::FlexItem FlexItem::toJuceFlexItem(juce::Rectangle<float> parentContentBounds,
-                                            LayoutStrategy strategy) const
+                                            LayoutStrategy strategy,
+                                            bool isInColumn) const
     {
-        juce::FlexItem flexItem;
+        JIVE_LAYOUT_STATS_SCOPE(toJuceFlexItem, state);
 
-        if (strategy == LayoutStrategy::real)
-            flexItem.associatedComponent = component.get();
+        const auto relativeBounds = getRelativeBoundsForFlexItem(parentContentBounds, strategy);
+        FlexItemValues values;
 
-        const auto minBounds = boxModel.getMinimumBounds();
-        flexItem.minWidth = minBounds.getWidth();
-        flexItem.minHeight = minBounds.getHeight();
+        if (!width.isAuto())
+            values.width = width.toPixels(relativeBounds);
+        if (!height.isAuto())
+            values.height = height.toPixels(relativeBounds);
 
-        if (state.getParent().getProperty("flex-direction").toString().contains("column"))
-        {
-            if (!width.isAuto())
-            {
-                flexItem.width = width.toPixels(strategy == LayoutStrategy::real ? parentContentBounds : juce::Rectangle<float>{});
-            }
-            else
-            {
-                if (idealWidth.exists())
-                {
-                    if (idealWidth.get() < parentContentBounds.getWidth() || strategy == LayoutStrategy::dummy)
-                        flexItem.minWidth = juce::jmax(flexItem.minWidth, idealWidth.get());
-                    else
-                        flexItem.width = parentContentBounds.getWidth();
-                }
-            }
+        values.minimumBounds = boxModel.getMinimumBounds();
 
-            if (!height.isAuto())
-            {
-                flexItem.height = height.toPixels(strategy == LayoutStrategy::real ? parentContentBounds : juce::Rectangle<float>{});
-            }
-            else
-            {
-                if (idealHeight.exists())
-                {
-                    auto property = state["ideal-height"];
-                    auto calculateHeight = property.getNativeFunction();
+        if (idealWidth.exists())
+            values.idealWidth = idealWidth.get();
 
-                    if (calculateHeight != nullptr)
-                    {
-                        juce::var args[] = {
-                            strategy == LayoutStrategy::dummy
-                                ? juce::jmin(idealWidth.get(), parentContentBounds.getWidth())
-                                : juce::jmax(flexItem.width, flexItem.minWidth),
-                        };
-                        flexItem.minHeight = juce::jmax(flexItem.minHeight,
-                                                        static_cast<float>(calculateHeight({ property, args, 1 })));
-                    }
-                    else
-                    {
-                        flexItem.minHeight = juce::jmax(flexItem.minHeight,
-                                                        static_cast<float>(property));
-                    }
-                }
-            }
-        }
-        else
+        if (idealHeight.exists())
         {
-            if (!width.isAuto())
-                flexItem.width = width.toPixels(strategy == LayoutStrategy::real ? parentContentBounds : juce::Rectangle<float>{});
-            else if (idealWidth.exists())
-                flexItem.width = idealWidth.get();
+            const auto property = state["ideal-height"];
 
-            if (!height.isAuto())
+            if (property.getNativeFunction() != nullptr)
             {
-                flexItem.height = height.toPixels(strategy == LayoutStrategy::real ? parentContentBounds : juce::Rectangle<float>{});
+                values.calculateIdealHeight = [property](float availableWidth) {
+                    juce::var args[] = { availableWidth };
+                    return static_cast<float>(property.getNativeFunction()({ property, args, 1 }));
+                };
             }
             else
             {
-                if (idealHeight.exists())
-                {
-                    auto property = state["ideal-height"];
-                    auto calculateHeight = property.getNativeFunction();
-
-                    if (calculateHeight != nullptr)
-                    {
-                        juce::var args[] = {
-                            strategy == LayoutStrategy::dummy
-                                ? juce::jmin(idealWidth.get(), parentContentBounds.getWidth())
-                                : juce::jmax(flexItem.width, flexItem.minWidth),
-                        };
-                        const auto idealHeightAbsolute = static_cast<float>(calculateHeight({ property, args, 1 }));
-
-                        if (idealHeightAbsolute < parentContentBounds.getHeight() || strategy == LayoutStrategy::dummy)
-                            flexItem.minHeight = juce::jmax(flexItem.minHeight, idealHeightAbsolute);
-                        else
-                            flexItem.height = parentContentBounds.getHeight();
-                    }
-                    else
-                    {
-                        flexItem.minHeight = juce::jmax(flexItem.minHeight,
-                                                        static_cast<float>(property));
-                    }
-                }
+                values.idealHeight = static_cast<float>(property);
             }
         }
 
-        flexItem.order = order;
-        flexItem.flexGrow = flexGrow;
-        flexItem.flexShrink = flexShrink;
-        flexItem.flexBasis = flexBasis;
-        flexItem.margin = transform(boxModel.getMargin());
+        values.order = order;
+        values.flexGrow = flexGrow;
+        values.flexShrink = flexShrink;
+        values.flexBasis = flexBasis;
+        values.alignSelf = alignSelf;
+        values.margin = boxModel.getMargin();
+
+        auto flexItem = createFlexItem(values, parentContentBounds, strategy, isInColumn);
 
         if (strategy == LayoutStrategy::real)
-            flexItem.alignSelf = alignSelf;
+            flexItem.associatedComponent = component.get();
 
         return flexItem;
     }
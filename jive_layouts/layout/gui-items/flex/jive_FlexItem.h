@@ -9,22 +9,38 @@ namespace jive
 
         juce::FlexItem toJuceFlexItem(juce::Rectangle<float> parentContentBounds,
                                       LayoutStrategy strategy) const;
+        juce::FlexItem toJuceFlexItem(juce::Rectangle<float> parentContentBounds,
+                                      LayoutStrategy strategy,
+                                      bool isInColumn) const;
+
+        // Incremented whenever a property read by toJuceFlexItem() changes,
+        // so that a container can tell which of its items need rebuilding.
+        // Call syncRevision() first to catch any changes to the box model
+        // properties, which aren't listened to.
+        void syncRevision();
+        juce::uint32 getRevision() const;
+        bool dependsOnParentBounds() const;
+        bool hasComputedIdealHeight() const;
 
     private:
         Property<int> order;
         Property<float> flexGrow;
         Property<float> flexShrink;
         Property<float> flexBasis;
-        Property<juce::FlexItem::AlignSelf> alignSelf;
+        CachedProperty<juce::FlexItem::AlignSelf> alignSelf;
         const Length width;
         const Length height;
-        const Length minWidth;
-        const Length minHeight;
+        Length minWidth;
+        Length minHeight;
         const Property<float> idealWidth;
         const Property<float> idealHeight;
 
         const BoxModel& boxModel;
 
+        static constexpr std::size_t numBoxModelSources = 5;
+        std::array<juce::var, numBoxModelSources> boxModelSources;
+        juce::uint32 revision{ 0 };
+
         JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(FlexItem)
     };
 } // namespace jive
@@ -57,6 +57,8 @@ namespace jive
 
     void GridContainer::layOutChildren()
     {
+        JIVE_LAYOUT_STATS_SCOPE(layOutChildren, state);
+
         const auto bounds = boxModel.getContentBounds().toNearestInt();
 
         if (bounds.getWidth() <= 0 || bounds.getHeight() <= 0)
@@ -73,35 +75,7 @@ namespace jive
     juce::Rectangle<float> GridContainer::calculateIdealSize(juce::Rectangle<float>) const
     {
         const auto grid = buildGridWithDummyItems();
-        juce::Point<float> extremities{ -1.0f, -1.0f };
-
-        for (const auto& gridItem : grid.items)
-        {
-            const auto right = gridItem.currentBounds.getRight() + gridItem.margin.right;
-            const auto bottom = gridItem.currentBounds.getBottom() + gridItem.margin.bottom;
-
-            if (right > extremities.x)
-                extremities.x = right;
-            if (bottom > extremities.y)
-                extremities.y = bottom;
-        }
-
-        return {
-            extremities.x
-                + boxModel
-                      .getPadding()
-                      .getLeftAndRight()
-                + boxModel
-                      .getBorder()
-                      .getLeftAndRight(),
-            extremities.y
-                + boxModel
-                      .getPadding()
-                      .getTopAndBottom()
-                + boxModel
-                      .getBorder()
-                      .getTopAndBottom(),
-        };
+        return calculateSizeToFit(grid.items, boxModel.getPadding(), boxModel.getBorder());
     }
 
     void appendChildren(GuiItem& container, juce::Grid& grid)
@@ -118,24 +92,22 @@ namespace jive
 
     juce::Grid GridContainer::buildGrid()
     {
-        juce::Grid grid;
-
-        grid.justifyItems = justifyItems;
-        grid.alignItems = alignItems;
-        grid.justifyContent = justifyContent;
-        grid.alignContent = alignContent;
-        grid.autoFlow = gridAutoFlow;
-
-        grid.templateColumns = gridTemplateColumns;
-        grid.templateRows = gridTemplateRows;
-        grid.templateAreas = gridTemplateAreas;
-        grid.autoRows = gridAutoRows;
-        grid.autoColumns = gridAutoColumns;
-
-        const auto gaps = gap.get();
-        grid.rowGap = gaps.size() > 0 ? gaps.getUnchecked(0) : juce::Grid::Px{ 0 };
-        grid.columnGap = gaps.size() > 1 ? gaps.getUnchecked(1) : grid.rowGap;
-
+        GridContainerValues values;
+
+        values.justifyItems = justifyItems;
+        values.alignItems = alignItems;
+        values.justifyContent = justifyContent;
+        values.alignContent = alignContent;
+        values.autoFlow = gridAutoFlow;
+
+        values.templateColumns = gridTemplateColumns;
+        values.templateRows = gridTemplateRows;
+        values.templateAreas = gridTemplateAreas;
+        values.autoRows = gridAutoRows;
+        values.autoColumns = gridAutoColumns;
+        values.gap = gap;
+
+        auto grid = createGrid(values);
         appendChildren(*this, grid);
 
         return grid;
@@ -144,14 +116,7 @@ namespace jive
     juce::Grid GridContainer::buildGridWithDummyItems() const
     {
         auto grid = const_cast<GridContainer*>(this)->buildGrid();
-
-        grid.autoRows = juce::Grid::Px{ 1 };
-        grid.autoColumns = juce::Grid::Px{ 1 };
-
-        for (auto& gridItem : grid.items)
-            gridItem.associatedComponent = nullptr;
-
-        grid.performLayout(juce::Rectangle{ 1, 1 });
+        performDummyGridLayout(grid);
 
         return grid;
     }
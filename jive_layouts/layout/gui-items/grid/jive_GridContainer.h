@@ -18,17 +18,17 @@ namespace jive
         juce::Grid buildGrid();
         juce::Grid buildGridWithDummyItems() const;
 
-        Property<juce::Grid::JustifyItems> justifyItems;
-        Property<juce::Grid::AlignItems> alignItems;
-        Property<juce::Grid::JustifyContent> justifyContent;
-        Property<juce::Grid::AlignContent> alignContent;
-        Property<juce::Grid::AutoFlow> gridAutoFlow;
-        Property<juce::Array<juce::Grid::TrackInfo>> gridTemplateColumns;
-        Property<juce::Array<juce::Grid::TrackInfo>> gridTemplateRows;
-        Property<juce::StringArray> gridTemplateAreas;
-        Property<juce::Grid::TrackInfo> gridAutoRows;
-        Property<juce::Grid::TrackInfo> gridAutoColumns;
-        Property<juce::Array<juce::Grid::Px>> gap;
+        CachedProperty<juce::Grid::JustifyItems> justifyItems;
+        CachedProperty<juce::Grid::AlignItems> alignItems;
+        CachedProperty<juce::Grid::JustifyContent> justifyContent;
+        CachedProperty<juce::Grid::AlignContent> alignContent;
+        CachedProperty<juce::Grid::AutoFlow> gridAutoFlow;
+        CachedProperty<juce::Array<juce::Grid::TrackInfo>> gridTemplateColumns;
+        CachedProperty<juce::Array<juce::Grid::TrackInfo>> gridTemplateRows;
+        CachedProperty<juce::StringArray> gridTemplateAreas;
+        CachedProperty<juce::Grid::TrackInfo> gridAutoRows;
+        CachedProperty<juce::Grid::TrackInfo> gridAutoColumns;
+        CachedProperty<juce::Array<juce::Grid::Px>> gap;
 
         const BoxModel& boxModel;
 
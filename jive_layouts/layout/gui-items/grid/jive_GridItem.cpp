@@ -21,6 +21,9 @@ namespace jive
         jassert(getParent() != nullptr);
 
         const auto invalidateParentBoxModel = [this]() {
+            if (auto* container = dynamic_cast<GuiItemDecorator*>(getParent())->toType<ContainerItem>())
+                container->invalidateIdealSize();
+
             getParent()->state.setProperty("is-valid", false, nullptr);
         };
         order.onValueChange = invalidateParentBoxModel;
@@ -37,45 +40,30 @@ namespace jive
         height.onValueChange = invalidateParentBoxModel;
     }
 
-    juce::GridItem::Margin boxModelToGridItemMargin(const BoxModel& boxModel)
-    {
-        const auto margin = boxModel.getMargin();
-
-        return {
-            margin.getTop(),
-            margin.getRight(),
-            margin.getBottom(),
-            margin.getLeft(),
-        };
-    }
-
     GridItem::operator juce::GridItem()
     {
-        juce::GridItem gridItem{ *component };
         const auto parentBounds = dynamic_cast<GuiItemDecorator*>(getParent())->toType<CommonGuiItem>()->boxModel.getBounds();
+        GridItemValues values;
 
         if (!width.isAuto())
-            gridItem.width = width.toPixels(parentBounds);
+            values.width = width.toPixels(parentBounds);
         if (!height.isAuto())
-            gridItem.height = height.toPixels(parentBounds);
-
-        const auto minBounds = boxModel.getMinimumBounds();
-        gridItem.minWidth = minBounds.getWidth();
-        gridItem.minHeight = minBounds.getHeight();
-
-        gridItem.maxWidth = maxWidth;
-        gridItem.maxHeight = maxHeight;
-
-        gridItem.order = order;
-
-        gridItem.justifySelf = justifySelf;
-        gridItem.alignSelf = alignSelf;
-
-        gridItem.column = gridColumn;
-        gridItem.row = gridRow;
-        gridItem.area = gridArea;
-
-        gridItem.margin = boxModelToGridItemMargin(boxModel);
+            values.height = height.toPixels(parentBounds);
+
+        values.minimumBounds = boxModel.getMinimumBounds();
+        values.maxWidth = maxWidth;
+        values.maxHeight = maxHeight;
+
+        values.order = order;
+        values.justifySelf = justifySelf;
+        values.alignSelf = alignSelf;
+        values.column = gridColumn;
+        values.row = gridRow;
+        values.area = gridArea;
+        values.margin = boxModel.getMargin();
+
+        auto gridItem = createGridItem(values);
+        gridItem.associatedComponent = component.get();
 
         return gridItem;
     }
@@ -11,10 +11,10 @@ namespace jive
 
     private:
         Property<int> order;
-        Property<juce::GridItem::JustifySelf> justifySelf;
-        Property<juce::GridItem::AlignSelf> alignSelf;
-        Property<juce::GridItem::StartAndEndProperty> gridColumn;
-        Property<juce::GridItem::StartAndEndProperty> gridRow;
+        CachedProperty<juce::GridItem::JustifySelf> justifySelf;
+        CachedProperty<juce::GridItem::AlignSelf> alignSelf;
+        CachedProperty<juce::GridItem::StartAndEndProperty> gridColumn;
+        CachedProperty<juce::GridItem::StartAndEndProperty> gridRow;
         Property<juce::String> gridArea;
         Property<float> maxWidth;
         Property<float> maxHeight;
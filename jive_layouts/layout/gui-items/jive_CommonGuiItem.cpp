@@ -168,7 +168,7 @@ namespace jive
         if (&componentThatsChildrenChanged != component.get())
             return;
 
-        getTopLevelDecorator().layOutChildren();
+        getTopLevelDecorator().requestLayout();
     }
 
     void CommonGuiItem::boxModelChanged(BoxModel& boxModelThatChanged)
@@ -177,7 +177,7 @@ namespace jive
 
         component->setSize(juce::roundToInt(boxModel.getWidth()),
                            juce::roundToInt(boxModel.getHeight()));
-        getTopLevelDecorator().layOutChildren();
+        getTopLevelDecorator().requestLayout();
     }
 } // namespace jive
 
@@ -13,18 +13,60 @@ namespace jive
 
     ContainerItem::~ContainerItem()
     {
+        StateTransaction::cancelCall(&idealWidth);
         boxModel.removeListener(*this);
     }
 
     void ContainerItem::addChild(std::unique_ptr<GuiItem> child)
     {
         GuiItemDecorator::addChild(std::move(child));
-        layoutChanged();
+
+        // Within a transaction the ideal size is only calculated once all the
+        // children have been added, rather than once per child. Calls queued
+        // with the same order are made in the order they were queued, which
+        // for a tree being built is children before their parents.
+        static constexpr auto idealSizesBeforeLayouts = -1;
+        StateTransaction::callWhenCommitted(&idealWidth,
+                                            idealSizesBeforeLayouts,
+                                            [safeThis = juce::WeakReference<GuiItem>{ this }]() {
+                                                if (auto* container = dynamic_cast<ContainerItem*>(safeThis.get()))
+                                                    container->layoutChanged();
+                                            });
+    }
+
+    void ContainerItem::invalidateIdealSize() noexcept
+    {
+        generation++;
+    }
+
+    ContainerItem::MeasureCacheStatistics ContainerItem::getMeasureCacheStatistics()
+    {
+        return getStatistics();
+    }
+
+    void ContainerItem::resetMeasureCacheStatistics()
+    {
+        getStatistics() = MeasureCacheStatistics{};
     }
 
-    void ContainerItem::boxModelInvalidated(BoxModel& box)
+    float ContainerItem::MeasureCacheStatistics::getHitRate() const noexcept
     {
-        const auto newIdealSize = calculateIdealSize(box.getBounds());
+        const auto total = hits + misses;
+
+        if (total == 0)
+            return 0.0f;
+
+        return static_cast<float>(hits) / static_cast<float>(total);
+    }
+
+    void ContainerItem::boxModelInvalidated(BoxModel& box, BoxModel::Invalidation invalidation)
+    {
+        // A child being resized by this container's layout doesn't change
+        // what the container measures, but anything else might have.
+        if (invalidation != BoxModel::Invalidation::childResized)
+            invalidateIdealSize();
+
+        const auto newIdealSize = measure(box.getBounds());
         const auto idealWidthChanged = newIdealSize.getWidth() != idealWidth.get();
         const auto idealHeightChanged = newIdealSize.getHeight() != idealHeight.get();
 
@@ -34,16 +76,152 @@ namespace jive
         const auto idealSizeChanged = idealWidthChanged || idealHeightChanged;
 
         if (!idealSizeChanged || isTopLevel())
-            layOutChildren();
+            getTopLevelDecorator().requestLayout();
     }
 
     void ContainerItem::layoutChanged()
     {
-        const auto newIdealSize = calculateIdealSize({
+        invalidateIdealSize();
+
+        const auto newIdealSize = measure({
             static_cast<float>(std::numeric_limits<juce::uint16>::max()),
             static_cast<float>(std::numeric_limits<juce::uint16>::max()),
         });
         idealWidth = newIdealSize.getWidth();
         idealHeight = newIdealSize.getHeight();
     }
+
+    ContainerItem::MeasureCacheStatistics& ContainerItem::getStatistics()
+    {
+        static MeasureCacheStatistics statistics;
+        return statistics;
+    }
+
+    juce::Rectangle<float> ContainerItem::measure(juce::Rectangle<float> constraints)
+    {
+        // Percentage sizes are resolved against the container's own bounds,
+        // and the container's padding and border are added to what the
+        // children measure, so all of those are part of the key.
+        const Measurement key{
+            generation,
+            constraints,
+            boxModel.getBounds(),
+            boxModel.getPadding(),
+            boxModel.getBorder(),
+            {},
+        };
+
+        for (const auto& measurement : measurements)
+        {
+            if (measurement.has_value()
+                && measurement->generation == key.generation
+                && measurement->constraints == key.constraints
+                && measurement->bounds == key.bounds
+                && measurement->padding == key.padding
+                && measurement->border == key.border)
+            {
+                getStatistics().hits++;
+                return measurement->idealSize;
+            }
+        }
+
+        getStatistics().misses++;
+
+        auto& measurement = measurements[nextMeasurement];
+        nextMeasurement = (nextMeasurement + 1) % measurements.size();
+
+        measurement = key;
+
+        JIVE_LAYOUT_STATS_SCOPE(calculateIdealSize, state);
+        measurement->idealSize = calculateIdealSize(constraints);
+
+        return measurement->idealSize;
+    }
 } // namespace jive
+
+#if JIVE_UNIT_TESTS
+class ContainerItemUnitTest : public juce::UnitTest
+{
+public:
+    ContainerItemUnitTest()
+        : juce::UnitTest{ "jive::ContainerItem", "jive" }
+    {
+    }
+
+    void runTest() final
+    {
+        testMeasureCache();
+    }
+
+private:
+    void testMeasureCache()
+    {
+        beginTest("measure cache");
+
+        juce::ValueTree innerState{
+            "Component",
+            {
+                { "align-items", "flex-start" },
+            },
+            {
+                juce::ValueTree{
+                    "Component",
+                    {
+                        { "width", "100%" },
+                        { "height", 10 },
+                    },
+                },
+                juce::ValueTree{
+                    "Component",
+                    {
+                        { "width", "100%" },
+                        { "height", 10 },
+                    },
+                },
+                juce::ValueTree{
+                    "Component",
+                    {
+                        { "width", "100%" },
+                        { "height", 10 },
+                    },
+                },
+            },
+        };
+        juce::ValueTree state{
+            "Component",
+            {
+                { "width", 400 },
+                { "height", 400 },
+            },
+            {
+                innerState,
+            },
+        };
+        jive::Interpreter interpreter;
+        auto item = interpreter.interpret(state);
+        expectEquals(static_cast<float>(innerState["ideal-height"]), 30.0f);
+
+        jive::ContainerItem::resetMeasureCacheStatistics();
+        expectEquals(jive::ContainerItem::getMeasureCacheStatistics().hits, 0);
+        expectEquals(jive::ContainerItem::getMeasureCacheStatistics().misses, 0);
+        expectEquals(jive::ContainerItem::getMeasureCacheStatistics().getHitRate(), 0.0f);
+
+        // Resizing the inner container resizes each of its children, none of
+        // which can change what the inner container measures.
+        state.setProperty("width", 300, nullptr);
+        const auto statistics = jive::ContainerItem::getMeasureCacheStatistics();
+        expectGreaterThan(statistics.hits, 0);
+        expectGreaterThan(statistics.getHitRate(), 0.0f);
+        expectLessOrEqual(statistics.getHitRate(), 1.0f);
+        expectEquals(static_cast<float>(innerState["ideal-height"]), 30.0f);
+
+        innerState.getChild(1).setProperty("height", 20, nullptr);
+        expectEquals(static_cast<float>(innerState["ideal-height"]), 40.0f);
+
+        innerState.getChild(2).setProperty("margin", "0 0 5 0", nullptr);
+        expectEquals(static_cast<float>(innerState["ideal-height"]), 45.0f);
+    }
+};
+
+static ContainerItemUnitTest containerItemUnitTest;
+#endif
@@ -7,22 +7,55 @@ namespace jive
         , private BoxModel::Listener
     {
     public:
+        struct MeasureCacheStatistics
+        {
+            float getHitRate() const noexcept;
+
+            int hits{ 0 };
+            int misses{ 0 };
+        };
+
         explicit ContainerItem(std::unique_ptr<GuiItem> itemToDecorate);
         ~ContainerItem() override;
 
         void addChild(std::unique_ptr<GuiItem> child) override;
 
+        void invalidateIdealSize() noexcept;
+
+        static MeasureCacheStatistics getMeasureCacheStatistics();
+        static void resetMeasureCacheStatistics();
+
     protected:
-        void boxModelInvalidated(BoxModel& boxModel) override;
+        void boxModelInvalidated(BoxModel& boxModel, BoxModel::Invalidation invalidation) override;
 
         virtual juce::Rectangle<float> calculateIdealSize(juce::Rectangle<float> constraints) const = 0;
 
         void layoutChanged();
 
     private:
+        struct Measurement
+        {
+            juce::uint32 generation;
+            juce::Rectangle<float> constraints;
+            juce::Rectangle<float> bounds;
+            juce::BorderSize<float> padding;
+            juce::BorderSize<float> border;
+            juce::Rectangle<float> idealSize;
+        };
+
+        static MeasureCacheStatistics& getStatistics();
+
+        juce::Rectangle<float> measure(juce::Rectangle<float> constraints);
+
         Property<float> idealWidth;
         Property<float> idealHeight;
 
         BoxModel& boxModel;
+
+        // Bumped whenever something a child contributes to this container's
+        // ideal size changes, which invalidates every cached measurement.
+        juce::uint32 generation{ 0 };
+        std::array<std::optional<Measurement>, 2> measurements;
+        std::size_t nextMeasurement{ 0 };
     };
 } // namespace jive
@@ -49,6 +49,11 @@ namespace jive
     {
     }
 
+    GuiItem::~GuiItem()
+    {
+        StateTransaction::cancelCall(this);
+    }
+
     const std::shared_ptr<const juce::Component> GuiItem::getComponent() const
     {
         return component;
@@ -90,6 +95,36 @@ namespace jive
         return getParent() == nullptr;
     }
 
+    static int getDepth(const GuiItem& item)
+    {
+        auto depth = 0;
+
+        for (auto* ancestor = item.getParent(); ancestor != nullptr; ancestor = ancestor->getParent())
+            depth++;
+
+        return depth;
+    }
+
+    void GuiItem::requestLayout()
+    {
+        // Items that are on screen are laid out once per message-loop tick,
+        // however many times they're invalidated in between.
+        if (component->getPeer() != nullptr)
+        {
+            LayoutScheduler::scheduleLayout(*this, getDepth(*this));
+            return;
+        }
+
+        // Parents are laid out before their children so that each container
+        // is laid out at most once when a transaction is committed.
+        StateTransaction::callWhenCommitted(this,
+                                            getDepth(*this),
+                                            [safeThis = juce::WeakReference<GuiItem>{ this }]() {
+                                                if (safeThis != nullptr)
+                                                    safeThis->layOutChildren();
+                                            });
+    }
+
     bool GuiItem::isContainer() const
     {
         return true;
@@ -113,9 +148,26 @@ public:
     void runTest() final
     {
         testChildren();
+        testLayoutRequestsDuringTransactions();
     }
 
 private:
+    struct LayoutCounter : public jive::GuiItemDecorator
+    {
+        explicit LayoutCounter(std::unique_ptr<jive::GuiItem> itemToDecorate)
+            : jive::GuiItemDecorator{ std::move(itemToDecorate) }
+        {
+        }
+
+        void layOutChildren() override
+        {
+            numLayouts++;
+            jive::GuiItemDecorator::layOutChildren();
+        }
+
+        int numLayouts = 0;
+    };
+
     void testChildren()
     {
         beginTest("children");
@@ -146,6 +198,53 @@ private:
         expectEquals(item->getChildren().size(), 3);
         expectEquals(item->getComponent()->getNumChildComponents(), item->getChildren().size());
     }
+
+    void testLayoutRequestsDuringTransactions()
+    {
+        beginTest("layout requests during transactions");
+
+        juce::ValueTree state{
+            "Component",
+            {
+                { "width", 200 },
+                { "height", 200 },
+                { "align-items", "flex-start" },
+            },
+            {
+                juce::ValueTree{
+                    "Button",
+                    {
+                        { "width", 50 },
+                        { "height", 20 },
+                    },
+                },
+            },
+        };
+        jive::Interpreter interpreter;
+        interpreter.addDecorator<LayoutCounter>("Component");
+        auto item = interpreter.interpret(state);
+        auto& counter = dynamic_cast<LayoutCounter&>(*item);
+
+        counter.numLayouts = 0;
+        state.setProperty("width", 300, nullptr);
+        state.setProperty("height", 250, nullptr);
+        state.setProperty("padding", 10, nullptr);
+        expectGreaterThan(counter.numLayouts, 1);
+
+        counter.numLayouts = 0;
+        {
+            jive::StateTransaction transaction;
+            state.setProperty("width", 400, nullptr);
+            state.setProperty("height", 350, nullptr);
+            state.setProperty("padding", 20, nullptr);
+            state.setProperty("width", 410, nullptr);
+            expectEquals(counter.numLayouts, 0);
+        }
+        expectEquals(counter.numLayouts, 1);
+        expectEquals(item->getComponent()->getWidth(), 410);
+        expectEquals(item->getComponent()->getHeight(), 350);
+        expectEquals(item->getChildren()[0]->getComponent()->getX(), 20);
+    }
 };
 
 static GuiItemUnitTest guiItemUnitTest;
@@ -13,7 +13,7 @@ namespace jive
                 GuiItem* parent = nullptr);
 
         GuiItem(const GuiItem& other);
-        virtual ~GuiItem() = default;
+        virtual ~GuiItem();
 
         const std::shared_ptr<const juce::Component> getComponent() const;
         const std::shared_ptr<juce::Component> getComponent();
@@ -29,6 +29,7 @@ namespace jive
         virtual bool isContent() const;
 
         virtual void layOutChildren() {}
+        void requestLayout();
 
         juce::ValueTree state;
 
@@ -52,6 +53,7 @@ namespace jive
         const StyleSheet::ReferenceCountedPointer styleSheet;
 #endif
 
+        JUCE_DECLARE_WEAK_REFERENCEABLE(GuiItem)
         JUCE_LEAK_DETECTOR(GuiItem)
     };
 } // namespace jive
@@ -96,23 +96,25 @@ namespace jive
 
 namespace juce
 {
-    const Array<var> VariantConverter<jive::Button::TriggerEvent>::options = {
-        "mouse-up",
-        "mouse-down",
-    };
+    static constexpr auto buttonTriggerEventKeywords = jive::KeywordTable<jive::Button::TriggerEvent, 2>::sort({ {
+        { "mouse-up", jive::Button::TriggerEvent::mouseUp },
+        { "mouse-down", jive::Button::TriggerEvent::mouseDown },
+    } });
+
+    const jive::KeywordTable<jive::Button::TriggerEvent, 2> VariantConverter<jive::Button::TriggerEvent>::keywords{ buttonTriggerEventKeywords };
 
     jive::Button::TriggerEvent VariantConverter<jive::Button::TriggerEvent>::fromVar(const var& v)
     {
-        jassert(options.contains(v));
-        return static_cast<jive::Button::TriggerEvent>(options.indexOf(v));
+        if (const auto value = keywords.find(v))
+            return *value;
+
+        jassertfalse;
+        return jive::Button::TriggerEvent::mouseUp;
     }
 
     var VariantConverter<jive::Button::TriggerEvent>::toVar(const jive::Button::TriggerEvent& event)
     {
-        const auto index = static_cast<int>(event);
-
-        jassert(options.size() >= index);
-        return options[index];
+        return keywords.toVar(event);
     }
 } // namespace juce
 
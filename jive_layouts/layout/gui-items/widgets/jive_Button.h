@@ -54,6 +54,6 @@ namespace juce
         static var toVar(const jive::Button::TriggerEvent& event);
 
     private:
-        static const Array<var> options;
+        static const jive::KeywordTable<jive::Button::TriggerEvent, 2> keywords;
     };
 } // namespace juce
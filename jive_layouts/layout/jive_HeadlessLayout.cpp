@@ -0,0 +1,1044 @@
+#include <jive_layouts/jive_layouts.h>
+
+namespace jive
+{
+    namespace headlessProperties
+    {
+        static const juce::Identifier width{ "width" };
+        static const juce::Identifier height{ "height" };
+        static const juce::Identifier minWidth{ "min-width" };
+        static const juce::Identifier minHeight{ "min-height" };
+        static const juce::Identifier flexDirection{ "flex-direction" };
+        static const juce::Identifier flexWrap{ "flex-wrap" };
+        static const juce::Identifier justifyContent{ "justify-content" };
+        static const juce::Identifier alignItems{ "align-items" };
+        static const juce::Identifier alignContent{ "align-content" };
+        static const juce::Identifier justifyItems{ "justify-items" };
+        static const juce::Identifier gridAutoFlow{ "grid-auto-flow" };
+        static const juce::Identifier gridTemplateColumns{ "grid-template-columns" };
+        static const juce::Identifier gridTemplateRows{ "grid-template-rows" };
+        static const juce::Identifier gridTemplateAreas{ "grid-template-areas" };
+        static const juce::Identifier gridAutoRows{ "grid-auto-rows" };
+        static const juce::Identifier gridAutoColumns{ "grid-auto-columns" };
+        static const juce::Identifier gap{ "gap" };
+        static const juce::Identifier maxWidth{ "max-width" };
+        static const juce::Identifier maxHeight{ "max-height" };
+        static const juce::Identifier order{ "order" };
+        static const juce::Identifier justifySelf{ "justify-self" };
+        static const juce::Identifier alignSelf{ "align-self" };
+        static const juce::Identifier gridColumn{ "grid-column" };
+        static const juce::Identifier gridRow{ "grid-row" };
+        static const juce::Identifier gridArea{ "grid-area" };
+        static const juce::Identifier x{ "x" };
+        static const juce::Identifier y{ "y" };
+        static const juce::Identifier centreX{ "centre-x" };
+        static const juce::Identifier centreY{ "centre-y" };
+        static const juce::Identifier display{ "display" };
+        static const juce::Identifier flexGrow{ "flex-grow" };
+        static const juce::Identifier flexShrink{ "flex-shrink" };
+        static const juce::Identifier flexBasis{ "flex-basis" };
+        static const juce::Identifier justification{ "justification" };
+        static const juce::Identifier text{ "text" };
+        static const juce::Identifier lineSpacing{ "line-spacing" };
+        static const juce::Identifier direction{ "direction" };
+        static const juce::Identifier wordWrap{ "word-wrap" };
+        static const juce::Identifier idealWidth{ "ideal-width" };
+        static const juce::Identifier idealHeight{ "ideal-height" };
+    } // namespace headlessProperties
+
+    namespace headless
+    {
+        static const juce::Identifier text{ "Text" };
+        static const juce::Identifier image{ "Image" };
+        static const juce::Identifier svg{ "svg" };
+
+        template <typename Value>
+        static Value getOr(const juce::ValueTree& tree, const juce::Identifier& id, const Value& valueIfMissing)
+        {
+            if (const auto* value = tree.getPropertyPointer(id))
+                return juce::VariantConverter<Value>::fromVar(*value);
+
+            return valueIfMissing;
+        }
+
+        // Looks the value up the tree's ancestors the same way a Property
+        // that inherits from its ancestors does.
+        template <typename Value>
+        static Value getInheritedOr(const juce::ValueTree& tree, const juce::Identifier& id, const Value& valueIfMissing)
+        {
+            for (auto treeToSearch = tree; treeToSearch.isValid(); treeToSearch = treeToSearch.getParent())
+            {
+                if (const auto* value = treeToSearch.getPropertyPointer(id))
+                    return juce::VariantConverter<Value>::fromVar(*value);
+            }
+
+            return valueIfMissing;
+        }
+
+        // Resolves a length the same way Length does, returning nothing for
+        // an auto length.
+        static std::optional<float> toPixels(const juce::ValueTree& tree,
+                                             const juce::Identifier& id,
+                                             float relativeParentLength)
+        {
+            const auto* source = tree.getPropertyPointer(id);
+
+            if (source == nullptr)
+                return std::nullopt;
+
+            if (!source->isString())
+                return static_cast<float>(*source);
+
+            const auto length = source->toString();
+
+            if (length.trim().equalsIgnoreCase("auto"))
+                return std::nullopt;
+
+            if (length.endsWith("%"))
+            {
+                return static_cast<float>(static_cast<double>(length.getFloatValue())
+                                          * 0.01
+                                          * static_cast<double>(relativeParentLength));
+            }
+
+            return length.getFloatValue();
+        }
+
+        static juce::Rectangle<float> calculateBoxSize(const juce::ValueTree& tree,
+                                                       juce::Rectangle<float> parentBounds)
+        {
+            const BoxModelView box{ tree };
+
+            return {
+                toPixels(tree, headlessProperties::width, parentBounds.getWidth())
+                    .value_or(box.getPadding().getLeftAndRight() + box.getBorder().getLeftAndRight()),
+                toPixels(tree, headlessProperties::height, parentBounds.getHeight())
+                    .value_or(box.getPadding().getTopAndBottom() + box.getBorder().getTopAndBottom()),
+            };
+        }
+
+        static juce::Rectangle<float> calculateMinimumBounds(const juce::ValueTree& tree,
+                                                             juce::Rectangle<float> parentBounds)
+        {
+            return {
+                toPixels(tree, headlessProperties::minWidth, parentBounds.getWidth()).value_or(0.0f),
+                toPixels(tree, headlessProperties::minHeight, parentBounds.getHeight()).value_or(0.0f),
+            };
+        }
+
+        // Items are given whole-pixel bounds by their components, which the
+        // flex box truncates and the grid rounds.
+        static juce::Rectangle<float> truncate(juce::Rectangle<float> bounds)
+        {
+            return juce::Rectangle<int>::leftTopRightBottom(static_cast<int>(bounds.getX()),
+                                                            static_cast<int>(bounds.getY()),
+                                                            static_cast<int>(bounds.getRight()),
+                                                            static_cast<int>(bounds.getBottom()))
+                .toFloat();
+        }
+
+        static FlexContainerValues getFlexContainerValues(const juce::ValueTree& tree)
+        {
+            FlexContainerValues values;
+
+            values.direction = getOr(tree, headlessProperties::flexDirection, values.direction);
+            values.wrap = getOr(tree, headlessProperties::flexWrap, values.wrap);
+            values.justifyContent = getOr(tree, headlessProperties::justifyContent, values.justifyContent);
+            values.alignItems = getOr(tree, headlessProperties::alignItems, values.alignItems);
+            values.alignContent = getOr(tree, headlessProperties::alignContent, values.alignContent);
+
+            return values;
+        }
+
+        static GridContainerValues getGridContainerValues(const juce::ValueTree& tree)
+        {
+            GridContainerValues values;
+
+            values.justifyItems = getOr(tree, headlessProperties::justifyItems, values.justifyItems);
+            values.alignItems = getOr(tree, headlessProperties::alignItems, values.alignItems);
+            values.justifyContent = getOr(tree, headlessProperties::justifyContent, values.justifyContent);
+            values.alignContent = getOr(tree, headlessProperties::alignContent, values.alignContent);
+            values.autoFlow = getOr(tree, headlessProperties::gridAutoFlow, values.autoFlow);
+
+            values.templateColumns = getOr(tree, headlessProperties::gridTemplateColumns, values.templateColumns);
+            values.templateRows = getOr(tree, headlessProperties::gridTemplateRows, values.templateRows);
+            values.templateAreas = getOr(tree, headlessProperties::gridTemplateAreas, values.templateAreas);
+            values.autoRows = getOr(tree, headlessProperties::gridAutoRows, values.autoRows);
+            values.autoColumns = getOr(tree, headlessProperties::gridAutoColumns, values.autoColumns);
+            values.gap = getOr(tree, headlessProperties::gap, values.gap);
+
+            return values;
+        }
+
+        static GridItemValues getGridItemValues(const juce::ValueTree& tree, juce::Rectangle<float> parentBounds)
+        {
+            GridItemValues values;
+
+            values.width = toPixels(tree, headlessProperties::width, parentBounds.getWidth());
+            values.height = toPixels(tree, headlessProperties::height, parentBounds.getHeight());
+            values.minimumBounds = calculateMinimumBounds(tree, parentBounds);
+            values.maxWidth = getOr(tree, headlessProperties::maxWidth, values.maxWidth);
+            values.maxHeight = getOr(tree, headlessProperties::maxHeight, values.maxHeight);
+
+            values.order = getOr(tree, headlessProperties::order, values.order);
+            values.justifySelf = getOr(tree, headlessProperties::justifySelf, values.justifySelf);
+            values.alignSelf = getOr(tree, headlessProperties::alignSelf, values.alignSelf);
+            values.column = getOr(tree, headlessProperties::gridColumn, values.column);
+            values.row = getOr(tree, headlessProperties::gridRow, values.row);
+            values.area = getOr(tree, headlessProperties::gridArea, values.area);
+            values.margin = BoxModelView{ tree }.getMargin();
+
+            return values;
+        }
+
+        static BlockItemValues getBlockItemValues(const juce::ValueTree& tree,
+                                                  juce::Rectangle<float> size,
+                                                  juce::Rectangle<float> parentContentBounds)
+        {
+            BlockItemValues values;
+
+            values.x = toPixels(tree, headlessProperties::x, parentContentBounds.getWidth());
+            values.y = toPixels(tree, headlessProperties::y, parentContentBounds.getHeight());
+            values.centreX = toPixels(tree, headlessProperties::centreX, parentContentBounds.getWidth());
+            values.centreY = toPixels(tree, headlessProperties::centreY, parentContentBounds.getHeight());
+            values.width = toPixels(tree, headlessProperties::width, parentContentBounds.getWidth());
+            values.height = toPixels(tree, headlessProperties::height, parentContentBounds.getHeight());
+            values.size = size;
+
+            return values;
+        }
+    } // namespace headless
+
+    class HeadlessLayout::Pass
+    {
+    public:
+        explicit Pass(const HeadlessLayout& headlessLayout)
+            : layout{ headlessLayout }
+        {
+        }
+
+        Node layOut(const juce::ValueTree& tree, juce::Rectangle<float> bounds)
+        {
+            Node node{ tree, bounds, {} };
+            layOutChildren(node);
+
+            return node;
+        }
+
+        juce::Rectangle<float> calculateIdealSize(const juce::ValueTree& tree)
+        {
+            const auto& intrinsicSize = calculateIntrinsicSize(tree);
+            const auto width = intrinsicSize.idealWidth.value_or(0.0f);
+
+            if (intrinsicSize.calculateIdealHeight != nullptr)
+                return { width, intrinsicSize.calculateIdealHeight(width) };
+
+            return { width, intrinsicSize.idealHeight.value_or(0.0f) };
+        }
+
+    private:
+        // Only the ideal sizes of these values are filled in.
+        using IntrinsicSize = FlexItemValues;
+
+        bool isItem(const juce::ValueTree& tree) const
+        {
+            return layout.itemTypes.find(tree.getType()) != std::end(layout.itemTypes);
+        }
+
+        bool isContainer(const juce::ValueTree& tree) const
+        {
+            const auto type = layout.itemTypes.find(tree.getType());
+            return type != std::end(layout.itemTypes) && type->second;
+        }
+
+        static bool isContent(const juce::ValueTree& tree)
+        {
+            return tree.hasType(headless::text)
+                || tree.hasType(headless::image)
+                || tree.hasType(headless::svg);
+        }
+
+        std::vector<juce::ValueTree> getChildItems(const juce::ValueTree& tree) const
+        {
+            std::vector<juce::ValueTree> children;
+
+            for (const auto& child : tree)
+            {
+                if (isItem(child) && (isContainer(tree) || isContent(child)))
+                    children.push_back(child);
+            }
+
+            return children;
+        }
+
+        void layOutChildren(Node& node)
+        {
+            const auto bounds = node.bounds.withZeroOrigin();
+            const BoxModelView box{ node.state };
+            const auto contentBounds = box.getPadding().subtractedFrom(box.getBorder().subtractedFrom(bounds));
+
+            for (const auto& child : getChildItems(node.state))
+                node.children.push_back({ child, headless::calculateBoxSize(child, bounds), {} });
+
+            if (!node.children.empty())
+            {
+                switch (headless::getOr(node.state, headlessProperties::display, Display::flex))
+                {
+                case Display::flex:
+                    layOutFlexChildren(node, bounds, contentBounds);
+                    break;
+                case Display::grid:
+                    layOutGridChildren(node, bounds, contentBounds);
+                    break;
+                case Display::block:
+                    layOutBlockChildren(node, contentBounds);
+                    break;
+                }
+            }
+
+            for (auto& child : node.children)
+                layOutChildren(child);
+        }
+
+        static bool isInColumn(const juce::ValueTree& tree)
+        {
+            // FlexContainer writes its default direction to the tree.
+            return !tree.hasProperty(headlessProperties::flexDirection)
+                || tree[headlessProperties::flexDirection].toString().contains("column");
+        }
+
+        juce::FlexBox buildFlexBox(const juce::ValueTree& tree,
+                                   juce::Rectangle<float> bounds,
+                                   juce::Rectangle<float> contentBounds,
+                                   LayoutStrategy strategy)
+        {
+            auto flex = createFlexBox(headless::getFlexContainerValues(tree), strategy);
+
+            for (const auto& child : getChildItems(tree))
+            {
+                flex.items.add(createFlexItem(getFlexItemValues(child, bounds, contentBounds, strategy),
+                                              contentBounds,
+                                              strategy,
+                                              isInColumn(tree)));
+            }
+
+            return flex;
+        }
+
+        FlexItemValues getFlexItemValues(const juce::ValueTree& tree,
+                                         juce::Rectangle<float> parentBounds,
+                                         juce::Rectangle<float> parentContentBounds,
+                                         LayoutStrategy strategy)
+        {
+            auto values = calculateIntrinsicSize(tree);
+
+            const auto relativeBounds = getRelativeBoundsForFlexItem(parentContentBounds, strategy);
+            values.width = headless::toPixels(tree, headlessProperties::width, relativeBounds.getWidth());
+            values.height = headless::toPixels(tree, headlessProperties::height, relativeBounds.getHeight());
+            values.minimumBounds = headless::calculateMinimumBounds(tree, parentBounds);
+
+            values.order = headless::getOr(tree, headlessProperties::order, values.order);
+            values.flexGrow = headless::getOr(tree, headlessProperties::flexGrow, values.flexGrow);
+            values.flexShrink = headless::getOr(tree, headlessProperties::flexShrink, values.flexShrink);
+            values.flexBasis = headless::getOr(tree, headlessProperties::flexBasis, values.flexBasis);
+            values.alignSelf = headless::getOr(tree, headlessProperties::alignSelf, values.alignSelf);
+            values.margin = BoxModelView{ tree }.getMargin();
+
+            return values;
+        }
+
+        void layOutFlexChildren(Node& node,
+                                juce::Rectangle<float> bounds,
+                                juce::Rectangle<float> contentBounds)
+        {
+            if (contentBounds.getWidth() <= 0 || contentBounds.getHeight() <= 0)
+                return;
+
+            auto flex = buildFlexBox(node.state, bounds, contentBounds, LayoutStrategy::real);
+            flex.performLayout(contentBounds);
+
+            for (std::size_t i = 0; i < node.children.size(); i++)
+                node.children[i].bounds = headless::truncate(flex.items.getReference(static_cast<int>(i)).currentBounds);
+        }
+
+        juce::Rectangle<float> calculateFlexIdealSize(const juce::ValueTree& tree,
+                                                      juce::Rectangle<float> bounds,
+                                                      juce::Rectangle<float> constraints)
+        {
+            constraints = getFlexIdealSizeConstraints(headless::getFlexContainerValues(tree).direction, constraints);
+
+            auto flex = buildFlexBox(tree, bounds, constraints, LayoutStrategy::dummy);
+            flex.performLayout(constraints);
+
+            const BoxModelView box{ tree };
+            return calculateSizeToFit(flex.items, box.getPadding(), box.getBorder());
+        }
+
+        juce::Grid buildGrid(const juce::ValueTree& tree, juce::Rectangle<float> bounds)
+        {
+            auto grid = createGrid(headless::getGridContainerValues(tree));
+
+            for (const auto& child : getChildItems(tree))
+                grid.items.add(createGridItem(headless::getGridItemValues(child, bounds)));
+
+            return grid;
+        }
+
+        void layOutGridChildren(Node& node,
+                                juce::Rectangle<float> bounds,
+                                juce::Rectangle<float> contentBounds)
+        {
+            const auto gridBounds = contentBounds.toNearestInt();
+
+            if (gridBounds.getWidth() <= 0 || gridBounds.getHeight() <= 0)
+                return;
+
+            auto grid = buildGrid(node.state, bounds);
+            grid.performLayout(gridBounds);
+
+            for (std::size_t i = 0; i < node.children.size(); i++)
+                node.children[i].bounds = grid.items.getReference(static_cast<int>(i)).currentBounds.toNearestIntEdges().toFloat();
+        }
+
+        juce::Rectangle<float> calculateGridIdealSize(const juce::ValueTree& tree, juce::Rectangle<float> bounds)
+        {
+            auto grid = buildGrid(tree, bounds);
+            performDummyGridLayout(grid);
+
+            const BoxModelView box{ tree };
+            return calculateSizeToFit(grid.items, box.getPadding(), box.getBorder());
+        }
+
+        static void layOutBlockChildren(Node& node, juce::Rectangle<float> contentBounds)
+        {
+            for (auto& child : node.children)
+            {
+                child.bounds = calculateBlockItemBounds(headless::getBlockItemValues(child.state, child.bounds, contentBounds),
+                                                        contentBounds)
+                                   .toFloat();
+            }
+        }
+
+        juce::AttributedString buildAttributedString(const juce::ValueTree& tree) const
+        {
+            juce::AttributedString attributedString;
+
+            attributedString.setText(tree[headlessProperties::text].toString());
+            attributedString.setFont(layout.font);
+            attributedString.setJustification(headless::getOr(tree, headlessProperties::justification, juce::Justification{ juce::Justification::centredLeft }));
+            attributedString.setLineSpacing(headless::getInheritedOr(tree, headlessProperties::lineSpacing, 0.0f));
+            attributedString.setReadingDirection(headless::getOr(tree, headlessProperties::direction, juce::AttributedString::ReadingDirection::natural));
+            attributedString.setWordWrap(headless::getOr(tree, headlessProperties::wordWrap, juce::AttributedString::WordWrap::byWord));
+
+            for (const auto& child : tree)
+            {
+                if (child.hasType(headless::text))
+                    attributedString.append(buildAttributedString(child));
+            }
+
+            return attributedString;
+        }
+
+        const IntrinsicSize& calculateIntrinsicSize(const juce::ValueTree& tree)
+        {
+            if (const auto cached = intrinsicSizes.find(&tree.getProperties());
+                cached != std::end(intrinsicSizes))
+            {
+                return cached->second;
+            }
+
+            IntrinsicSize size;
+
+            if (tree.hasType(headless::text))
+            {
+                const auto attributedString = buildAttributedString(tree);
+                size.idealWidth = std::ceil(layout.measureText(attributedString, std::numeric_limits<float>::max()).getWidth());
+                size.calculateIdealHeight = [measureText = layout.measureText, attributedString](float maxWidth) {
+                    return std::ceil(measureText(attributedString, maxWidth).getHeight());
+                };
+            }
+            else if (!getChildItems(tree).empty())
+            {
+                // As measured by ContainerItem::layoutChanged().
+                static constexpr auto maxSize = static_cast<float>(std::numeric_limits<juce::uint16>::max());
+                const juce::Rectangle<float> constraints{ maxSize, maxSize };
+                const auto bounds = headless::calculateBoxSize(tree, {});
+                juce::Rectangle<float> idealSize;
+
+                switch (headless::getOr(tree, headlessProperties::display, Display::flex))
+                {
+                case Display::flex:
+                    idealSize = calculateFlexIdealSize(tree, bounds, constraints);
+                    break;
+                case Display::grid:
+                    idealSize = calculateGridIdealSize(tree, bounds);
+                    break;
+                case Display::block:
+                    break;
+                }
+
+                size.idealWidth = idealSize.getWidth();
+                size.idealHeight = idealSize.getHeight();
+            }
+            else
+            {
+                // Ideal sizes calculated by functions in the tree can't be
+                // called safely from here.
+                if (const auto* idealWidth = tree.getPropertyPointer(headlessProperties::idealWidth); idealWidth != nullptr && !idealWidth->isMethod())
+                    size.idealWidth = static_cast<float>(*idealWidth);
+                if (const auto* idealHeight = tree.getPropertyPointer(headlessProperties::idealHeight); idealHeight != nullptr && !idealHeight->isMethod())
+                    size.idealHeight = static_cast<float>(*idealHeight);
+            }
+
+            return intrinsicSizes[&tree.getProperties()] = std::move(size);
+        }
+
+        const HeadlessLayout& layout;
+        std::unordered_map<const juce::NamedValueSet*, IntrinsicSize> intrinsicSizes;
+    };
+
+    // The widgets that never lay out children of their own, only content.
+    static bool isContainerType(const juce::Identifier& type)
+    {
+        static const std::unordered_set<juce::Identifier> nonContainerTypes{
+            "Button",
+            "Checkbox",
+            "ComboBox",
+            "Hyperlink",
+            "Image",
+            "Knob",
+            "Label",
+            "ProgressBar",
+            "Slider",
+            "Spinner",
+            "svg",
+            "Text",
+        };
+
+        return nonContainerTypes.count(type) == 0;
+    }
+
+    HeadlessLayout::HeadlessLayout()
+        : HeadlessLayout{ ComponentFactory{}, measureWithTextLayout }
+    {
+    }
+
+    HeadlessLayout::HeadlessLayout(TextMeasurer textMeasurer)
+        : HeadlessLayout{ ComponentFactory{}, std::move(textMeasurer) }
+    {
+    }
+
+    HeadlessLayout::HeadlessLayout(const ComponentFactory& componentFactory, TextMeasurer textMeasurer)
+        : measureText{ std::move(textMeasurer) }
+    {
+        jassert(measureText != nullptr);
+
+        for (const auto& type : componentFactory.getTypes())
+            itemTypes[type] = isContainerType(type);
+
+        setFont(juce::Font{});
+    }
+
+    void HeadlessLayout::setItemType(const juce::Identifier& type, bool isContainer)
+    {
+        itemTypes[type] = isContainer;
+    }
+
+    void HeadlessLayout::setFont(const juce::Font& newFont)
+    {
+        JUCE_ASSERT_MESSAGE_THREAD
+
+        font = newFont;
+        font.getTypefacePtr();
+    }
+
+    HeadlessLayout::Node HeadlessLayout::calculateLayout(const juce::ValueTree& tree) const
+    {
+        const auto width = headless::toPixels(tree, headlessProperties::width, 0.0f);
+        const auto height = headless::toPixels(tree, headlessProperties::height, 0.0f);
+
+        if (width.has_value() && height.has_value())
+            return calculateLayout(tree, { *width, *height });
+
+        const auto idealSize = calculateIdealSize(tree);
+        return calculateLayout(tree, { width.value_or(idealSize.getWidth()), height.value_or(idealSize.getHeight()) });
+    }
+
+    HeadlessLayout::Node HeadlessLayout::calculateLayout(const juce::ValueTree& tree, juce::Rectangle<float> size) const
+    {
+        jassert(tree.isValid());
+
+        // Top-level components are given their size rounded to whole pixels.
+        return Pass{ *this }.layOut(tree, size.withZeroOrigin().toNearestInt().toFloat());
+    }
+
+    juce::Rectangle<float> HeadlessLayout::calculateIdealSize(const juce::ValueTree& tree) const
+    {
+        return Pass{ *this }.calculateIdealSize(tree);
+    }
+
+    juce::Rectangle<float> HeadlessLayout::measureWithTextLayout(const juce::AttributedString& text, float maxWidth)
+    {
+        const auto layout = TextLayoutCache::getLayout(text, maxWidth);
+        return { layout->getWidth(), layout->getHeight() };
+    }
+} // namespace jive
+
+#if JIVE_UNIT_TESTS
+class HeadlessLayoutUnitTest : public juce::UnitTest
+{
+public:
+    HeadlessLayoutUnitTest()
+        : juce::UnitTest{ "jive::HeadlessLayout", "jive" }
+    {
+    }
+
+    void runTest() final
+    {
+        testFlex();
+        testNestedIdealSizes();
+        testText();
+        testGrid();
+        testBlock();
+        testSkippedItems();
+        testItemTypes();
+        testReadOnly();
+        testBackgroundThread();
+    }
+
+private:
+    void expectMatchesInterpreter(const juce::ValueTree& state)
+    {
+        const auto node = jive::HeadlessLayout{}.calculateLayout(state.createCopy());
+
+        jive::Interpreter interpreter;
+        const auto item = interpreter.interpret(state.createCopy());
+        expectMatches(node, *item);
+    }
+
+    void expectMatches(const jive::HeadlessLayout::Node& node, const jive::GuiItem& item)
+    {
+        expectEquals(node.bounds.toNearestInt(), item.getComponent()->getBounds(), node.state.getType().toString());
+
+        const auto children = item.getChildren();
+        expectEquals(static_cast<int>(node.children.size()), children.size());
+
+        for (std::size_t i = 0; i < node.children.size() && static_cast<int>(i) < children.size(); i++)
+            expectMatches(node.children[i], *children[static_cast<int>(i)]);
+    }
+
+    void testFlex()
+    {
+        beginTest("flex");
+
+        expectMatchesInterpreter(juce::ValueTree{
+            "Component",
+            {
+                { "width", 300 },
+                { "height", 200 },
+                { "padding", 10 },
+                { "border-width", 2 },
+                { "flex-direction", "row" },
+                { "justify-content", "space-between" },
+            },
+            {
+                juce::ValueTree{
+                    "Component",
+                    {
+                        { "width", 50 },
+                        { "height", 40 },
+                        { "margin", 5 },
+                    },
+                },
+                juce::ValueTree{
+                    "Component",
+                    {
+                        { "flex-grow", 1 },
+                        { "height", 20 },
+                        { "align-self", "flex-end" },
+                    },
+                },
+                juce::ValueTree{
+                    "Component",
+                    {
+                        { "width", "25%" },
+                        { "height", "50%" },
+                    },
+                },
+            },
+        });
+
+        const auto node = jive::HeadlessLayout{}.calculateLayout(juce::ValueTree{
+            "Component",
+            {
+                { "width", 100 },
+                { "height", 100 },
+            },
+            {
+                juce::ValueTree{ "Component", { { "height", 30 } } },
+                juce::ValueTree{ "Component", { { "height", 20 } } },
+            },
+        });
+        expectEquals(node.bounds, juce::Rectangle{ 100.0f, 100.0f });
+        expectEquals(node.children[0].bounds, juce::Rectangle{ 0.0f, 0.0f, 100.0f, 30.0f });
+        expectEquals(node.children[1].bounds, juce::Rectangle{ 0.0f, 30.0f, 100.0f, 20.0f });
+    }
+
+    void testNestedIdealSizes()
+    {
+        beginTest("nested ideal sizes");
+
+        juce::ValueTree state{
+            "Component",
+            {
+                { "width", 400 },
+                { "height", 300 },
+                { "align-items", "flex-start" },
+            },
+            {
+                juce::ValueTree{
+                    "Component",
+                    {
+                        { "flex-direction", "row" },
+                        { "padding", 4 },
+                    },
+                    {
+                        juce::ValueTree{ "Component", { { "width", 30 }, { "height", 20 } } },
+                        juce::ValueTree{ "Component", { { "width", 40 }, { "height", 10 }, { "margin", 2 } } },
+                    },
+                },
+                juce::ValueTree{
+                    "Component",
+                    {},
+                    {
+                        juce::ValueTree{ "Component", { { "width", 60 }, { "height", 60 } } },
+                    },
+                },
+            },
+        };
+        expectMatchesInterpreter(state);
+
+        expectEquals(jive::HeadlessLayout{}.calculateIdealSize(state.getChild(0)),
+                     juce::Rectangle{ 82.0f, 28.0f });
+    }
+
+    void testText()
+    {
+        beginTest("text");
+
+        expectMatchesInterpreter(juce::ValueTree{
+            "Component",
+            {
+                { "width", 300 },
+                { "height", 200 },
+                { "align-items", "flex-start" },
+            },
+            {
+                juce::ValueTree{ "Text", { { "text", "Gain" } } },
+                juce::ValueTree{
+                    "Component",
+                    {
+                        { "padding", 5 },
+                    },
+                    {
+                        juce::ValueTree{ "Text", { { "text", "Bypass" } } },
+                    },
+                },
+            },
+        });
+
+        const jive::HeadlessLayout layout{ [](const juce::AttributedString& text, float) {
+            return juce::Rectangle{ 10.0f * static_cast<float>(text.getText().length()), 12.0f };
+        } };
+        const auto node = layout.calculateLayout(juce::ValueTree{
+            "Component",
+            {
+                { "align-items", "flex-start" },
+            },
+            {
+                juce::ValueTree{ "Text", { { "text", "Mix" } } },
+                juce::ValueTree{
+                    "Text",
+                    {
+                        { "text", "Dry" },
+                    },
+                    {
+                        juce::ValueTree{ "Text", { { "text", "/Wet" } } },
+                    },
+                },
+            },
+        });
+        expectEquals(node.bounds, juce::Rectangle{ 70.0f, 24.0f });
+        expectEquals(node.children[0].bounds, juce::Rectangle{ 30.0f, 12.0f });
+        expectEquals(node.children[1].bounds, juce::Rectangle{ 0.0f, 12.0f, 70.0f, 12.0f });
+
+        const jive::HeadlessLayout spacedLayout{ [](const juce::AttributedString& text, float) {
+            return juce::Rectangle{ 10.0f * static_cast<float>(text.getText().length()), 12.0f + text.getLineSpacing() };
+        } };
+        const auto spacedNode = spacedLayout.calculateLayout(juce::ValueTree{
+            "Component",
+            {
+                { "align-items", "flex-start" },
+                { "line-spacing", 4 },
+            },
+            {
+                juce::ValueTree{
+                    "Component",
+                    {},
+                    {
+                        juce::ValueTree{ "Text", { { "text", "Mix" } } },
+                    },
+                },
+                juce::ValueTree{ "Text", { { "text", "Dry" }, { "line-spacing", 1 } } },
+            },
+        });
+        expectEquals(spacedNode.children[0].children[0].bounds, juce::Rectangle{ 30.0f, 16.0f });
+        expectEquals(spacedNode.children[1].bounds, juce::Rectangle{ 0.0f, 16.0f, 30.0f, 13.0f });
+    }
+
+    void testGrid()
+    {
+        beginTest("grid");
+
+        expectMatchesInterpreter(juce::ValueTree{
+            "Component",
+            {
+                { "width", 300 },
+                { "height", 200 },
+                { "display", "grid" },
+                { "padding", 10 },
+                { "gap", 10 },
+                { "grid-template-columns", "1fr 2fr" },
+                { "grid-template-rows", "1fr 1fr" },
+            },
+            {
+                juce::ValueTree{ "Component" },
+                juce::ValueTree{ "Component", { { "margin", 5 } } },
+                juce::ValueTree{ "Component", { { "width", "50%" }, { "height", 40 } } },
+            },
+        });
+    }
+
+    void testBlock()
+    {
+        beginTest("block");
+
+        expectMatchesInterpreter(juce::ValueTree{
+            "Component",
+            {
+                { "width", 200 },
+                { "height", 100 },
+                { "display", "block" },
+                { "padding", 10 },
+            },
+            {
+                juce::ValueTree{
+                    "Component",
+                    {
+                        { "x", "10%" },
+                        { "y", 5 },
+                        { "width", 20 },
+                        { "height", 20 },
+                    },
+                },
+                juce::ValueTree{
+                    "Component",
+                    {
+                        { "centre-x", "50%" },
+                        { "centre-y", "50%" },
+                        { "width", 40 },
+                        { "height", "50%" },
+                    },
+                },
+            },
+        });
+    }
+
+    void testSkippedItems()
+    {
+        beginTest("skipped items");
+
+        juce::ValueTree state{
+            "Component",
+            {
+                { "width", 100 },
+                { "height", 100 },
+            },
+            {
+                juce::ValueTree{ "Unknown", { { "height", 10 } } },
+                juce::ValueTree{
+                    "Button",
+                    {
+                        { "height", 50 },
+                    },
+                    {
+                        juce::ValueTree{ "Component" },
+                    },
+                },
+            },
+        };
+        expectMatchesInterpreter(state);
+
+        jive::HeadlessLayout layout;
+        expectEquals(static_cast<int>(layout.calculateLayout(state).children.size()), 1);
+        expect(layout.calculateLayout(state).children[0].children.empty());
+
+        layout.setItemType("Unknown", true);
+        expectEquals(static_cast<int>(layout.calculateLayout(state).children.size()), 2);
+
+        jive::ComponentFactory factory;
+        factory.set("Unknown", []() {
+            return std::make_unique<juce::Component>();
+        });
+        const jive::HeadlessLayout layoutWithFactory{ factory, jive::HeadlessLayout::measureWithTextLayout };
+        expectEquals(static_cast<int>(layoutWithFactory.calculateLayout(state).children.size()), 2);
+    }
+
+    void testItemTypes()
+    {
+        beginTest("item types");
+
+        const jive::HeadlessLayout layout;
+        jive::Interpreter interpreter;
+
+        for (const auto& type : jive::ComponentFactory{}.getTypes())
+        {
+            // A window is given a peer of its own, which isn't wanted here.
+            if (type == juce::Identifier{ "Window" })
+                continue;
+
+            const juce::ValueTree state{
+                "Component",
+                {
+                    { "width", 100 },
+                    { "height", 100 },
+                },
+                {
+                    juce::ValueTree{
+                        type,
+                        {},
+                        {
+                            juce::ValueTree{ "Component" },
+                            juce::ValueTree{ "Text" },
+                        },
+                    },
+                },
+            };
+
+            const auto node = layout.calculateLayout(state.createCopy());
+            const auto item = interpreter.interpret(state.createCopy());
+            expectEquals(static_cast<int>(node.children.size()), item->getChildren().size(), type.toString());
+
+            if (!node.children.empty() && !item->getChildren().isEmpty())
+            {
+                expectEquals(static_cast<int>(node.children[0].children.size()),
+                             item->getChildren()[0]->getChildren().size(),
+                             type.toString());
+            }
+        }
+    }
+
+    void testReadOnly()
+    {
+        beginTest("read-only");
+
+        struct ChangeCounter : public juce::ValueTree::Listener
+        {
+            void valueTreePropertyChanged(juce::ValueTree&, const juce::Identifier&) final
+            {
+                numChanges++;
+            }
+
+            void valueTreeChildAdded(juce::ValueTree&, juce::ValueTree&) final
+            {
+                numChanges++;
+            }
+
+            int numChanges = 0;
+        };
+
+        juce::ValueTree state{
+            "Component",
+            {
+                { "padding", 5 },
+            },
+            {
+                juce::ValueTree{ "Text", { { "text", "Hello" } } },
+                juce::ValueTree{ "Component", { { "width", "50%" }, { "height", 10 } } },
+            },
+        };
+        ChangeCounter counter;
+        state.addListener(&counter);
+
+        const auto numNodesBefore = jive::LayoutNodeStore::getInstance().getNumNodes();
+        jive::HeadlessLayout{}.calculateLayout(state);
+
+        expectEquals(counter.numChanges, 0);
+        expectEquals(jive::LayoutNodeStore::getInstance().getNumNodes(), numNodesBefore);
+
+        state.removeListener(&counter);
+    }
+
+    void testBackgroundThread()
+    {
+        beginTest("background thread");
+
+        juce::ValueTree state{
+            "Component",
+            {
+                { "width", 640 },
+                { "height", 480 },
+                { "flex-direction", "row" },
+                { "flex-wrap", "wrap" },
+            },
+        };
+
+        for (auto i = 0; i < 100; i++)
+        {
+            state.appendChild(juce::ValueTree{
+                                  "Text",
+                                  {
+                                      { "text", "Channel " + juce::String{ i } },
+                                  },
+                              },
+                              nullptr);
+        }
+
+        // A typeface that's never been looked up before, so the background
+        // thread can't be relying on anything cached by an earlier layout.
+        jive::HeadlessLayout layout;
+        layout.setFont(juce::Font{ "JIVE " + juce::Uuid{}.toString(), 15.0f, juce::Font::plain });
+
+        struct LayoutThread : public juce::Thread
+        {
+            LayoutThread(const jive::HeadlessLayout& headlessLayout, const juce::ValueTree& tree)
+                : juce::Thread{ "Headless layout" }
+                , layout{ headlessLayout }
+                , state{ tree }
+            {
+            }
+
+            void run() final
+            {
+                result = layout.calculateLayout(state);
+            }
+
+            const jive::HeadlessLayout& layout;
+            const juce::ValueTree state;
+            std::optional<jive::HeadlessLayout::Node> result;
+        };
+
+        LayoutThread thread{ layout, state };
+        thread.startThread();
+        expect(thread.waitForThreadToExit(10000));
+        expect(thread.result.has_value());
+
+        const auto expected = layout.calculateLayout(state);
+
+        for (std::size_t i = 0; thread.result.has_value() && i < expected.children.size(); i++)
+            expectEquals(thread.result->children[i].bounds, expected.children[i].bounds);
+    }
+};
+
+static HeadlessLayoutUnitTest headlessLayoutUnitTest;
+#endif
@@ -0,0 +1,63 @@
+#pragma once
+
+namespace jive
+{
+    // Calculates the bounds the Interpreter would give each item in a tree,
+    // using the same flex, grid and block rules, but without creating any
+    // GuiItems or Components. Laying out only reads from the tree, so it can
+    // be done on any thread as long as nothing modifies the tree meanwhile.
+    //
+    // Text is measured with a single font, whose typeface is looked up when
+    // the font is set, which has to be on the message thread. Fonts set by
+    // style sheets, aliases, custom decorators and the intrinsic sizes of
+    // images aren't known here, so items relying on them should be given
+    // explicit sizes, or ideal-width and ideal-height properties.
+    class HeadlessLayout
+    {
+    public:
+        struct Node
+        {
+            juce::ValueTree state;
+
+            // Relative to the parent node, as a component's bounds would be.
+            juce::Rectangle<float> bounds;
+
+            std::vector<Node> children;
+        };
+
+        // Returns the size of the given text when laid out within the given
+        // width. Called from whichever thread the layout is calculated on.
+        using TextMeasurer = std::function<juce::Rectangle<float>(const juce::AttributedString&, float maxWidth)>;
+
+        // Must be constructed on the message thread.
+        HeadlessLayout();
+        explicit HeadlessLayout(TextMeasurer textMeasurer);
+        HeadlessLayout(const ComponentFactory& componentFactory, TextMeasurer textMeasurer);
+
+        // Types that aren't given a component by the ComponentFactory are
+        // skipped, as the Interpreter would skip them. Custom types are
+        // treated as containers unless declared otherwise here.
+        void setItemType(const juce::Identifier& type, bool isContainer);
+
+        // Must be called on the message thread.
+        void setFont(const juce::Font& newFont);
+
+        // Top-level items without an explicit width or height are given their
+        // ideal size.
+        Node calculateLayout(const juce::ValueTree& tree) const;
+        Node calculateLayout(const juce::ValueTree& tree, juce::Rectangle<float> size) const;
+
+        juce::Rectangle<float> calculateIdealSize(const juce::ValueTree& tree) const;
+
+        static juce::Rectangle<float> measureWithTextLayout(const juce::AttributedString& text, float maxWidth);
+
+    private:
+        class Pass;
+
+        TextMeasurer measureText;
+        std::unordered_map<juce::Identifier, bool> itemTypes;
+        juce::Font font;
+
+        JUCE_LEAK_DETECTOR(HeadlessLayout)
+    };
+} // namespace jive
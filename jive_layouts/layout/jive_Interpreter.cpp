@@ -32,7 +32,10 @@ namespace jive
 
     std::unique_ptr<GuiItem> Interpreter::interpret(const juce::ValueTree& tree) const
     {
-        return interpret(tree, nullptr);
+        auto item = interpret(tree, nullptr);
+        LayoutScheduler::flushLayoutNow();
+
+        return item;
     }
 
     std::unique_ptr<GuiItem> Interpreter::interpret(const juce::XmlElement& xml) const
@@ -0,0 +1,191 @@
+#include <jive_layouts/jive_layouts.h>
+
+namespace jive
+{
+    void LayoutScheduler::scheduleLayout(GuiItem& item, int depth)
+    {
+        JUCE_ASSERT_MESSAGE_THREAD
+
+        auto& scheduler = getInstance();
+
+        // Overwriting any existing entry also replaces a stale reference to a
+        // deleted item that happened to share this item's address.
+        scheduler.dirtyItems[&item] = DirtyItem{ &item, depth };
+
+        if (!scheduler.isFlushing)
+            scheduler.triggerAsyncUpdate();
+    }
+
+    void LayoutScheduler::flushLayoutNow()
+    {
+        JUCE_ASSERT_MESSAGE_THREAD
+
+        auto& scheduler = getInstance();
+
+        if (scheduler.isFlushing)
+            return;
+
+        const juce::ScopedValueSetter<bool> flushing{ scheduler.isFlushing, true };
+        scheduler.cancelPendingUpdate();
+
+        // Laying out an item can dirty its children, so keep going until a
+        // pass leaves nothing behind.
+        while (!scheduler.dirtyItems.empty())
+        {
+            std::vector<DirtyItem> items;
+            items.reserve(scheduler.dirtyItems.size());
+
+            for (auto& dirtyItem : scheduler.dirtyItems)
+                items.push_back(std::move(dirtyItem.second));
+
+            scheduler.dirtyItems.clear();
+
+            std::sort(std::begin(items),
+                      std::end(items),
+                      [](const DirtyItem& a, const DirtyItem& b) {
+                          return a.depth < b.depth;
+                      });
+
+            for (auto& dirtyItem : items)
+            {
+                if (dirtyItem.item != nullptr)
+                    dirtyItem.item->layOutChildren();
+            }
+        }
+    }
+
+    bool LayoutScheduler::isLayoutPending()
+    {
+        return !getInstance().dirtyItems.empty();
+    }
+
+    LayoutScheduler& LayoutScheduler::getInstance()
+    {
+        static LayoutScheduler scheduler;
+        return scheduler;
+    }
+
+    void LayoutScheduler::handleAsyncUpdate()
+    {
+        flushLayoutNow();
+    }
+} // namespace jive
+
+#if JIVE_UNIT_TESTS
+class LayoutSchedulerUnitTest : public juce::UnitTest
+{
+public:
+    LayoutSchedulerUnitTest()
+        : juce::UnitTest{ "jive::LayoutScheduler", "jive" }
+    {
+    }
+
+    void runTest() final
+    {
+        testDeferredLayout();
+        testLayoutOffScreen();
+    }
+
+private:
+    struct LayoutCounter : public jive::GuiItemDecorator
+    {
+        explicit LayoutCounter(std::unique_ptr<jive::GuiItem> itemToDecorate)
+            : jive::GuiItemDecorator{ std::move(itemToDecorate) }
+        {
+        }
+
+        void layOutChildren() override
+        {
+            numLayouts++;
+            jive::GuiItemDecorator::layOutChildren();
+        }
+
+        int numLayouts = 0;
+    };
+
+    void testDeferredLayout()
+    {
+        beginTest("deferred layout");
+
+        juce::ValueTree state{
+            "Window",
+            {
+                { "width", 200 },
+                { "height", 200 },
+                { "align-items", "flex-start" },
+            },
+            {
+                juce::ValueTree{
+                    "Component",
+                    {
+                        { "width", 50 },
+                        { "height", 20 },
+                    },
+                },
+            },
+        };
+        jive::Interpreter interpreter;
+        interpreter.addDecorator<LayoutCounter>("Window");
+        auto item = interpreter.interpret(state);
+        auto& counter = dynamic_cast<LayoutCounter&>(*item);
+        expect(!jive::LayoutScheduler::isLayoutPending());
+        expectEquals(item->getChildren()[0]->getComponent()->getWidth(), 50);
+
+        counter.numLayouts = 0;
+        state.setProperty("padding", 10, nullptr);
+        state.setProperty("width", 300, nullptr);
+        state.setProperty("padding", 20, nullptr);
+        item->getChildren()[0]->state.setProperty("width", 60, nullptr);
+        expectEquals(counter.numLayouts, 0);
+        expect(jive::LayoutScheduler::isLayoutPending());
+
+        jive::LayoutScheduler::flushLayoutNow();
+        expectEquals(counter.numLayouts, 1);
+        expect(!jive::LayoutScheduler::isLayoutPending());
+        expectEquals(item->getChildren()[0]->getComponent()->getX(), 20);
+        expectEquals(item->getChildren()[0]->getComponent()->getWidth(), 60);
+
+        jive::LayoutScheduler::flushLayoutNow();
+        expectEquals(counter.numLayouts, 1);
+
+        state.setProperty("padding", 5, nullptr);
+        item.reset();
+        jive::LayoutScheduler::flushLayoutNow();
+        expect(!jive::LayoutScheduler::isLayoutPending());
+    }
+
+    void testLayoutOffScreen()
+    {
+        beginTest("layout off-screen");
+
+        juce::ValueTree state{
+            "Component",
+            {
+                { "width", 200 },
+                { "height", 200 },
+            },
+            {
+                juce::ValueTree{
+                    "Component",
+                    {
+                        { "width", 50 },
+                        { "height", 20 },
+                    },
+                },
+            },
+        };
+        jive::Interpreter interpreter;
+        interpreter.addDecorator<LayoutCounter>("Component");
+        auto item = interpreter.interpret(state);
+        auto& counter = dynamic_cast<LayoutCounter&>(*item);
+
+        counter.numLayouts = 0;
+        state.setProperty("padding", 10, nullptr);
+        expectEquals(counter.numLayouts, 1);
+        expect(!jive::LayoutScheduler::isLayoutPending());
+        expectEquals(item->getChildren()[0]->getComponent()->getX(), 10);
+    }
+};
+
+static LayoutSchedulerUnitTest layoutSchedulerUnitTest;
+#endif
@@ -0,0 +1,30 @@
+#pragma once
+
+namespace jive
+{
+    class LayoutScheduler : private juce::AsyncUpdater
+    {
+    public:
+        static void scheduleLayout(GuiItem& item, int depth);
+        static void flushLayoutNow();
+        static bool isLayoutPending();
+
+    private:
+        struct DirtyItem
+        {
+            juce::WeakReference<GuiItem> item;
+            int depth;
+        };
+
+        LayoutScheduler() = default;
+
+        static LayoutScheduler& getInstance();
+
+        void handleAsyncUpdate() final;
+
+        std::unordered_map<const GuiItem*, DirtyItem> dirtyItems;
+        bool isFlushing{ false };
+
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(LayoutScheduler)
+    };
+} // namespace jive
@@ -0,0 +1,381 @@
+#include <jive_layouts/jive_layouts.h>
+
+namespace jive
+{
+    JUCE_IMPLEMENT_SINGLETON(ParallelMeasurer)
+
+    ParallelMeasurer::ParallelMeasurer()
+        : pool{ juce::jmax(1, juce::SystemStats::getNumCpus() - 1) }
+    {
+    }
+
+    ParallelMeasurer::~ParallelMeasurer()
+    {
+        StateTransaction::cancelCall(this);
+        clearSingletonInstance();
+    }
+
+    void ParallelMeasurer::measure(const void* key, Measure measureFunction)
+    {
+        if (!StateTransaction::isInProgress())
+        {
+            if (auto apply = measureFunction())
+                apply();
+
+            return;
+        }
+
+        auto& measurer = *getInstance();
+
+        if (const auto queued = measurer.queuedIndices.find(key);
+            queued != std::end(measurer.queuedIndices))
+        {
+            measurer.queue[queued->second].measure = std::move(measureFunction);
+            return;
+        }
+
+        measurer.queuedIndices[key] = measurer.queue.size();
+        measurer.queue.push_back({ key, std::move(measureFunction) });
+
+        // Measurements are applied before containers calculate their ideal
+        // sizes, which in turn happens before any layouts.
+        static constexpr auto measurementsBeforeIdealSizes = -2;
+        StateTransaction::callWhenCommitted(&measurer,
+                                            measurementsBeforeIdealSizes,
+                                            [&measurer]() {
+                                                measurer.measureQueuedItems();
+                                            });
+    }
+
+    int ParallelMeasurer::getNumThreads()
+    {
+        return getInstance()->pool.getNumThreads();
+    }
+
+    void ParallelMeasurer::measureQueuedItems()
+    {
+        auto measurements = std::move(queue);
+        queue.clear();
+        queuedIndices.clear();
+
+        std::vector<Apply> results(measurements.size());
+
+        // Not worth waking the workers for just a handful of items.
+        static constexpr std::size_t minimumForConcurrency = 16;
+
+        if (measurements.size() < minimumForConcurrency)
+        {
+            for (std::size_t i = 0; i < measurements.size(); i++)
+                results[i] = measurements[i].measure();
+        }
+        else
+        {
+            measureConcurrently(measurements, results);
+        }
+
+        for (auto& apply : results)
+        {
+            if (apply != nullptr)
+                apply();
+        }
+    }
+
+    void ParallelMeasurer::measureConcurrently(std::vector<Measurement>& measurements,
+                                               std::vector<Apply>& results)
+    {
+        // Each thread, including this one, takes the next unmeasured item
+        // until there are none left, so no thread sits idle while another is
+        // stuck with a run of expensive items.
+        std::atomic<std::size_t> nextIndex{ 0 };
+        const auto measureRemainingItems = [&measurements, &results, &nextIndex]() {
+            for (auto i = nextIndex++; i < measurements.size(); i = nextIndex++)
+                results[i] = measurements[i].measure();
+        };
+
+        const auto numWorkers = juce::jmin(pool.getNumThreads(),
+                                           static_cast<int>(measurements.size()) - 1);
+        std::atomic<int> numWorkersRunning{ numWorkers };
+        juce::WaitableEvent workersFinished;
+
+        for (auto i = 0; i < numWorkers; i++)
+        {
+            pool.addJob([&measureRemainingItems, &numWorkersRunning, &workersFinished]() {
+                measureRemainingItems();
+
+                if (--numWorkersRunning == 0)
+                    workersFinished.signal();
+            });
+        }
+
+        measureRemainingItems();
+
+        if (numWorkers > 0)
+            workersFinished.wait();
+    }
+} // namespace jive
+
+#if JIVE_UNIT_TESTS
+class ParallelMeasurerUnitTest : public juce::UnitTest
+{
+public:
+    ParallelMeasurerUnitTest()
+        : juce::UnitTest{ "jive::ParallelMeasurer", "jive" }
+    {
+    }
+
+    void runTest() final
+    {
+        testImmediateMeasurement();
+        testDeferredMeasurement();
+        testReplacedMeasurement();
+        testTextMeasurement();
+        testUnresolvedTypefaces();
+    }
+
+private:
+    void testImmediateMeasurement()
+    {
+        beginTest("immediate measurement");
+
+        auto result = 0;
+        jive::ParallelMeasurer::measure(&result, [&result]() -> jive::ParallelMeasurer::Apply {
+            return [&result]() {
+                result = 42;
+            };
+        });
+        expectEquals(result, 42);
+    }
+
+    void testDeferredMeasurement()
+    {
+        beginTest("deferred measurement");
+
+        static constexpr auto numItems = 200;
+        std::array<int, numItems> results{};
+        std::vector<int> applyOrder;
+        const auto messageThread = juce::Thread::getCurrentThreadId();
+        std::atomic<bool> appliedOnAnotherThread{ false };
+
+        {
+            jive::StateTransaction transaction;
+
+            for (auto i = 0; i < numItems; i++)
+            {
+                jive::ParallelMeasurer::measure(&results[static_cast<std::size_t>(i)],
+                                                [&, i]() -> jive::ParallelMeasurer::Apply {
+                                                    const auto measurement = i * i;
+
+                                                    return [&, i, measurement]() {
+                                                        if (juce::Thread::getCurrentThreadId() != messageThread)
+                                                            appliedOnAnotherThread = true;
+
+                                                        results[static_cast<std::size_t>(i)] = measurement;
+                                                        applyOrder.push_back(i);
+                                                    };
+                                                });
+            }
+
+            expect(applyOrder.empty());
+        }
+
+        expect(!appliedOnAnotherThread);
+        expectEquals(static_cast<int>(applyOrder.size()), numItems);
+
+        for (auto i = 0; i < numItems; i++)
+        {
+            expectEquals(results[static_cast<std::size_t>(i)], i * i);
+            expectEquals(applyOrder[static_cast<std::size_t>(i)], i);
+        }
+    }
+
+    void testReplacedMeasurement()
+    {
+        beginTest("replaced measurement");
+
+        auto result = 0;
+        auto numMeasurements = 0;
+
+        {
+            jive::StateTransaction transaction;
+
+            for (auto value : { 1, 2, 3 })
+            {
+                jive::ParallelMeasurer::measure(&result, [&result, &numMeasurements, value]() -> jive::ParallelMeasurer::Apply {
+                    numMeasurements++;
+
+                    return [&result, value]() {
+                        result = value;
+                    };
+                });
+            }
+        }
+
+        expectEquals(numMeasurements, 1);
+        expectEquals(result, 3);
+    }
+
+    void testTextMeasurement()
+    {
+        beginTest("text measurement");
+
+        juce::ValueTree state{
+            "Component",
+            {
+                { "flex-direction", "column" },
+                { "align-items", "flex-start" },
+            },
+        };
+
+        for (auto i = 0; i < 50; i++)
+        {
+            state.appendChild(juce::ValueTree{
+                                  "Text",
+                                  {
+                                      { "text", "Channel " + juce::String{ i } },
+                                  },
+                              },
+                              nullptr);
+        }
+
+        // The deferred measurements are made first, so they aren't helped by
+        // anything the serial measurements may have cached.
+        jive::Interpreter interpreter;
+        std::unique_ptr<jive::GuiItem> deferredItem;
+
+        {
+            jive::StateTransaction transaction;
+            deferredItem = interpreter.interpret(state);
+        }
+
+        const auto serialItem = interpreter.interpret(state.createCopy());
+
+        for (auto i = 0; i < state.getNumChildren(); i++)
+        {
+            const auto& expected = serialItem->getChildren()[i]->state;
+            const auto& actual = deferredItem->getChildren()[i]->state;
+
+            expectGreaterThan(static_cast<float>(actual["ideal-width"]), 0.0f);
+            expectEquals(static_cast<float>(actual["ideal-width"]),
+                         static_cast<float>(expected["ideal-width"]));
+            expectEquals(deferredItem->getChildren()[i]->getComponent()->getBounds(),
+                         serialItem->getChildren()[i]->getComponent()->getBounds());
+        }
+    }
+
+    void testUnresolvedTypefaces()
+    {
+        beginTest("unresolved typefaces");
+
+        // Nothing has been measured with this typeface before, so its
+        // typeface is found for the first time by the transaction.
+        const juce::Font font{ "JIVE " + juce::Uuid{}.toString(), 15.0f, juce::Font::plain };
+
+        juce::ValueTree state{
+            "Component",
+            {
+                { "flex-direction", "column" },
+                { "align-items", "flex-start" },
+            },
+        };
+
+        for (auto i = 0; i < 50; i++)
+        {
+            state.appendChild(juce::ValueTree{
+                                  "Text",
+                                  {
+                                      { "text", "Bus " + juce::String{ i } },
+                                  },
+                              },
+                              nullptr);
+        }
+
+        jive::Interpreter interpreter;
+        std::unique_ptr<jive::GuiItem> item;
+
+        {
+            jive::StateTransaction transaction;
+            item = interpreter.interpret(state);
+
+            for (auto* child : item->getChildren())
+                dynamic_cast<jive::GuiItemDecorator*>(child)->toType<jive::Text>()->getTextComponent().setFont(font);
+        }
+
+        for (auto* child : item->getChildren())
+        {
+            juce::AttributedString text;
+            text.append(child->state["text"].toString(), font);
+
+            juce::TextLayout expected;
+            expected.createLayout(text, std::numeric_limits<float>::max());
+
+            expectEquals(static_cast<float>(child->state["ideal-width"]), std::ceil(expected.getWidth()));
+        }
+    }
+};
+
+static ParallelMeasurerUnitTest parallelMeasurerUnitTest;
+
+class ParallelMeasurerBenchmark : public juce::UnitTest
+{
+public:
+    ParallelMeasurerBenchmark()
+        : juce::UnitTest{ "jive::ParallelMeasurer", "jive-micro-benchmarks" }
+    {
+    }
+
+    void runTest() final
+    {
+        beginTest("open 1.5k labels");
+
+        juce::ValueTree state{
+            "Component",
+            {
+                { "width", 1000 },
+                { "height", 1000 },
+                { "flex-direction", "row" },
+                { "flex-wrap", "wrap" },
+            },
+        };
+
+        for (auto i = 0; i < numLabels; i++)
+        {
+            state.appendChild(juce::ValueTree{
+                                  "Text",
+                                  {
+                                      { "text", "Channel " + juce::String{ i } + " - Gain Reduction" },
+                                  },
+                              },
+                              nullptr);
+        }
+
+        jive::Interpreter interpreter;
+
+        const auto serialStart = juce::Time::getHighResolutionTicks();
+        const auto serialItem = interpreter.interpret(state.createCopy());
+        const auto serialSeconds = juce::Time::highResolutionTicksToSeconds(juce::Time::getHighResolutionTicks() - serialStart);
+
+        std::unique_ptr<jive::GuiItem> parallelItem;
+        const auto parallelStart = juce::Time::getHighResolutionTicks();
+
+        {
+            jive::StateTransaction transaction;
+            parallelItem = interpreter.interpret(state);
+        }
+
+        const auto parallelSeconds = juce::Time::highResolutionTicksToSeconds(juce::Time::getHighResolutionTicks() - parallelStart);
+
+        logMessage(juce::String{ serialSeconds * 1000.0, 1 } + "ms to open "
+                   + juce::String{ numLabels } + " labels measured serially, "
+                   + juce::String{ parallelSeconds * 1000.0, 1 } + "ms measured on "
+                   + juce::String{ jive::ParallelMeasurer::getNumThreads() + 1 } + " threads");
+
+        expectEquals(parallelItem->getChildren()[numLabels - 1]->getComponent()->getBounds(),
+                     serialItem->getChildren()[numLabels - 1]->getComponent()->getBounds());
+    }
+
+private:
+    static constexpr auto numLabels = 1500;
+};
+
+static ParallelMeasurerBenchmark parallelMeasurerBenchmark;
+#endif
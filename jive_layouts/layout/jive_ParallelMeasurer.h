@@ -0,0 +1,52 @@
+#pragma once
+
+namespace jive
+{
+    // Splits measuring an item's intrinsic size from applying it. Measurements
+    // queued during a StateTransaction are made concurrently on a pool of
+    // worker threads once the transaction is committed, and then applied on
+    // the message thread in the order they were queued, before any ideal sizes
+    // are calculated or layouts performed. Outside a transaction, items are
+    // measured and the result applied immediately.
+    class ParallelMeasurer : private juce::DeletedAtShutdown
+    {
+    public:
+        using Apply = std::function<void()>;
+
+        // Called on a worker thread, so mustn't touch any item, component or
+        // tree, only the values it captured. Returns the function to be called
+        // on the message thread to apply the measurement.
+        using Measure = std::function<Apply()>;
+
+        // Queuing another measurement with the same key before the first one
+        // is made replaces it.
+        static void measure(const void* key, Measure measureFunction);
+
+        static int getNumThreads();
+
+    private:
+        struct Measurement
+        {
+            const void* key;
+            Measure measure;
+        };
+
+        // The workers are stopped when JUCE shuts down, rather than when
+        // static objects are destroyed after it already has.
+        ParallelMeasurer();
+        ~ParallelMeasurer() override;
+
+        JUCE_DECLARE_SINGLETON_SINGLETHREADED_MINIMAL(ParallelMeasurer)
+
+        void measureQueuedItems();
+        void measureConcurrently(std::vector<Measurement>& measurements,
+                                 std::vector<Apply>& results);
+
+        juce::ThreadPool pool;
+
+        std::vector<Measurement> queue;
+        std::unordered_map<const void*, std::size_t> queuedIndices;
+
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ParallelMeasurer)
+    };
+} // namespace jive
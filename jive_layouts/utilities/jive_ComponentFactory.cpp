@@ -104,6 +104,16 @@ namespace jive
     {
         creators.insert({ name, creator });
     }
+
+    juce::Array<juce::Identifier> ComponentFactory::getTypes() const
+    {
+        juce::Array<juce::Identifier> types;
+
+        for (const auto& creator : creators)
+            types.add(creator.first);
+
+        return types;
+    }
 } // namespace jive
 
 #if JIVE_UNIT_TESTS
@@ -1,18 +1,5 @@
 #pragma once
 
-namespace std
-{
-    template <>
-    class hash<juce::Identifier>
-    {
-    public:
-        std::size_t operator()(const juce::Identifier& id) const
-        {
-            return id.toString().hash();
-        }
-    };
-} // namespace std
-
 namespace jive
 {
     class ComponentFactory
@@ -25,6 +12,8 @@ namespace jive
         std::unique_ptr<juce::Component> create(juce::Identifier name) const;
         void set(juce::Identifier name, ComponentCreator creator);
 
+        juce::Array<juce::Identifier> getTypes() const;
+
     private:
         std::unordered_map<juce::Identifier, ComponentCreator> creators;
     };
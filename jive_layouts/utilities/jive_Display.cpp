@@ -2,23 +2,25 @@
 
 namespace juce
 {
-    const Array<var> VariantConverter<jive::Display>::options = {
-        "flex",
-        "grid",
-        "block"
-    };
+    static constexpr auto displayKeywords = jive::KeywordTable<jive::Display, 3>::sort({ {
+        { "flex", jive::Display::flex },
+        { "grid", jive::Display::grid },
+        { "block", jive::Display::block },
+    } });
+
+    const jive::KeywordTable<jive::Display, 3> VariantConverter<jive::Display>::keywords{ displayKeywords };
 
     jive::Display VariantConverter<jive::Display>::fromVar(const var& v)
     {
-        jassert(options.contains(v));
-        return static_cast<jive::Display>(options.indexOf(v));
+        if (const auto value = keywords.find(v))
+            return *value;
+
+        jassertfalse;
+        return jive::Display::flex;
     }
 
     var VariantConverter<jive::Display>::toVar(jive::Display display)
     {
-        const auto index = static_cast<int>(display);
-
-        jassert(options.size() >= index);
-        return options[index];
+        return keywords.toVar(display);
     }
 } // namespace juce
@@ -19,6 +19,6 @@ namespace juce
         static var toVar(jive::Display display);
 
     private:
-        static const Array<var> options;
+        static const jive::KeywordTable<jive::Display, 3> keywords;
     };
 } // namespace juce
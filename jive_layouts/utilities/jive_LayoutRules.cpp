@@ -0,0 +1,256 @@
+#include <jive_layouts/jive_layouts.h>
+
+namespace jive
+{
+    juce::FlexBox createFlexBox(const FlexContainerValues& values, LayoutStrategy strategy)
+    {
+        juce::FlexBox flex;
+
+        flex.flexDirection = values.direction;
+        flex.flexWrap = values.wrap;
+
+        switch (strategy)
+        {
+        case LayoutStrategy::real:
+            flex.justifyContent = values.justifyContent;
+            flex.alignItems = values.alignItems;
+            flex.alignContent = values.alignContent;
+            break;
+        case LayoutStrategy::dummy:
+            flex.justifyContent = juce::FlexBox::JustifyContent::flexStart;
+            flex.alignItems = juce::FlexBox::AlignItems::flexStart;
+            flex.alignContent = juce::FlexBox::AlignContent::flexStart;
+            break;
+        default:
+            jassertfalse;
+        }
+
+        return flex;
+    }
+
+    juce::Rectangle<float> getRelativeBoundsForFlexItem(juce::Rectangle<float> parentContentBounds,
+                                                        LayoutStrategy strategy)
+    {
+        return strategy == LayoutStrategy::real ? parentContentBounds : juce::Rectangle<float>{};
+    }
+
+    juce::FlexItem createFlexItem(const FlexItemValues& values,
+                                  juce::Rectangle<float> parentContentBounds,
+                                  LayoutStrategy strategy,
+                                  bool isInColumn)
+    {
+        juce::FlexItem flexItem;
+
+        flexItem.minWidth = values.minimumBounds.getWidth();
+        flexItem.minHeight = values.minimumBounds.getHeight();
+
+        const auto calculateIdealHeight = [&values, &flexItem, &parentContentBounds, strategy]() {
+            return values.calculateIdealHeight(strategy == LayoutStrategy::dummy
+                                                   ? juce::jmin(values.idealWidth.value_or(0.0f), parentContentBounds.getWidth())
+                                                   : juce::jmax(flexItem.width, flexItem.minWidth));
+        };
+
+        if (isInColumn)
+        {
+            if (values.width.has_value())
+            {
+                flexItem.width = *values.width;
+            }
+            else if (values.idealWidth.has_value())
+            {
+                if (*values.idealWidth < parentContentBounds.getWidth() || strategy == LayoutStrategy::dummy)
+                    flexItem.minWidth = juce::jmax(flexItem.minWidth, *values.idealWidth);
+                else
+                    flexItem.width = parentContentBounds.getWidth();
+            }
+
+            if (values.height.has_value())
+                flexItem.height = *values.height;
+            else if (values.calculateIdealHeight != nullptr)
+                flexItem.minHeight = juce::jmax(flexItem.minHeight, calculateIdealHeight());
+            else if (values.idealHeight.has_value())
+                flexItem.minHeight = juce::jmax(flexItem.minHeight, *values.idealHeight);
+        }
+        else
+        {
+            if (values.width.has_value())
+                flexItem.width = *values.width;
+            else if (values.idealWidth.has_value())
+                flexItem.width = *values.idealWidth;
+
+            if (values.height.has_value())
+            {
+                flexItem.height = *values.height;
+            }
+            else if (values.calculateIdealHeight != nullptr)
+            {
+                const auto idealHeight = calculateIdealHeight();
+
+                if (idealHeight < parentContentBounds.getHeight() || strategy == LayoutStrategy::dummy)
+                    flexItem.minHeight = juce::jmax(flexItem.minHeight, idealHeight);
+                else
+                    flexItem.height = parentContentBounds.getHeight();
+            }
+            else if (values.idealHeight.has_value())
+            {
+                flexItem.minHeight = juce::jmax(flexItem.minHeight, *values.idealHeight);
+            }
+        }
+
+        flexItem.order = values.order;
+        flexItem.flexGrow = values.flexGrow;
+        flexItem.flexShrink = values.flexShrink;
+        flexItem.flexBasis = values.flexBasis;
+        flexItem.margin = juce::FlexItem::Margin{
+            values.margin.getTop(),
+            values.margin.getRight(),
+            values.margin.getBottom(),
+            values.margin.getLeft(),
+        };
+
+        if (strategy == LayoutStrategy::real)
+            flexItem.alignSelf = values.alignSelf;
+
+        return flexItem;
+    }
+
+    juce::Rectangle<float> getFlexIdealSizeConstraints(juce::FlexBox::Direction direction,
+                                                       juce::Rectangle<float> constraints)
+    {
+        switch (direction)
+        {
+        case juce::FlexBox::Direction::column:
+        case juce::FlexBox::Direction::columnReverse:
+            constraints.setHeight(std::numeric_limits<float>::max());
+            break;
+        case juce::FlexBox::Direction::row:
+        case juce::FlexBox::Direction::rowReverse:
+            constraints.setWidth(std::numeric_limits<float>::max());
+            break;
+        default:
+            jassertfalse;
+        }
+
+        return constraints;
+    }
+
+    juce::Grid createGrid(const GridContainerValues& values)
+    {
+        juce::Grid grid;
+
+        grid.justifyItems = values.justifyItems;
+        grid.alignItems = values.alignItems;
+        grid.justifyContent = values.justifyContent;
+        grid.alignContent = values.alignContent;
+        grid.autoFlow = values.autoFlow;
+
+        grid.templateColumns = values.templateColumns;
+        grid.templateRows = values.templateRows;
+        grid.templateAreas = values.templateAreas;
+        grid.autoRows = values.autoRows;
+        grid.autoColumns = values.autoColumns;
+
+        grid.rowGap = values.gap.size() > 0 ? values.gap.getUnchecked(0) : juce::Grid::Px{ 0 };
+        grid.columnGap = values.gap.size() > 1 ? values.gap.getUnchecked(1) : grid.rowGap;
+
+        return grid;
+    }
+
+    juce::GridItem createGridItem(const GridItemValues& values)
+    {
+        juce::GridItem gridItem;
+
+        if (values.width.has_value())
+            gridItem.width = *values.width;
+        if (values.height.has_value())
+            gridItem.height = *values.height;
+
+        gridItem.minWidth = values.minimumBounds.getWidth();
+        gridItem.minHeight = values.minimumBounds.getHeight();
+
+        gridItem.maxWidth = values.maxWidth;
+        gridItem.maxHeight = values.maxHeight;
+
+        gridItem.order = values.order;
+
+        gridItem.justifySelf = values.justifySelf;
+        gridItem.alignSelf = values.alignSelf;
+
+        gridItem.column = values.column;
+        gridItem.row = values.row;
+        gridItem.area = values.area;
+
+        gridItem.margin = juce::GridItem::Margin{
+            values.margin.getTop(),
+            values.margin.getRight(),
+            values.margin.getBottom(),
+            values.margin.getLeft(),
+        };
+
+        return gridItem;
+    }
+
+    void performDummyGridLayout(juce::Grid& grid)
+    {
+        grid.autoRows = juce::Grid::Px{ 1 };
+        grid.autoColumns = juce::Grid::Px{ 1 };
+
+        for (auto& gridItem : grid.items)
+            gridItem.associatedComponent = nullptr;
+
+        grid.performLayout(juce::Rectangle{ 1, 1 });
+    }
+
+    juce::Rectangle<int> calculateBlockItemBounds(const BlockItemValues& values,
+                                                  juce::Rectangle<float> parentContentBounds)
+    {
+        juce::Rectangle<int> bounds;
+
+        if (values.width.has_value())
+            bounds.setWidth(juce::roundToInt(*values.width));
+        if (values.height.has_value())
+            bounds.setHeight(juce::roundToInt(*values.height));
+
+        const auto x = values.centreX.has_value()
+                         ? juce::roundToInt(*values.centreX - values.size.getWidth() / 2.0f)
+                         : juce::roundToInt(values.x.value_or(0.0f));
+        const auto y = values.centreY.has_value()
+                         ? juce::roundToInt(*values.centreY - values.size.getHeight() / 2.0f)
+                         : juce::roundToInt(values.y.value_or(0.0f));
+
+        return bounds.withPosition(parentContentBounds.getPosition().roundToInt() + juce::Point{ x, y });
+    }
+
+    template <typename Item>
+    static juce::Rectangle<float> calculateSizeToFitItems(const juce::Array<Item>& items,
+                                                          const juce::BorderSize<float>& padding,
+                                                          const juce::BorderSize<float>& border)
+    {
+        juce::Point<float> extremities{ -1.0f, -1.0f };
+
+        for (const auto& item : items)
+        {
+            extremities.x = juce::jmax(extremities.x, item.currentBounds.getRight() + item.margin.right);
+            extremities.y = juce::jmax(extremities.y, item.currentBounds.getBottom() + item.margin.bottom);
+        }
+
+        return {
+            extremities.x + padding.getLeftAndRight() + border.getLeftAndRight(),
+            extremities.y + padding.getTopAndBottom() + border.getTopAndBottom(),
+        };
+    }
+
+    juce::Rectangle<float> calculateSizeToFit(const juce::Array<juce::FlexItem>& items,
+                                              const juce::BorderSize<float>& padding,
+                                              const juce::BorderSize<float>& border)
+    {
+        return calculateSizeToFitItems(items, padding, border);
+    }
+
+    juce::Rectangle<float> calculateSizeToFit(const juce::Array<juce::GridItem>& items,
+                                              const juce::BorderSize<float>& padding,
+                                              const juce::BorderSize<float>& border)
+    {
+        return calculateSizeToFitItems(items, padding, border);
+    }
+} // namespace jive
@@ -0,0 +1,122 @@
+#pragma once
+
+namespace jive
+{
+    // The rules by which items are placed in flex, grid and block layouts.
+    // The GuiItems read each value from their cached properties and the
+    // HeadlessLayout reads them straight from the tree, but both then build
+    // their layouts with the functions below, so the two always agree.
+
+    struct FlexContainerValues
+    {
+        juce::FlexBox::Direction direction{ juce::FlexBox::Direction::column };
+        juce::FlexBox::Wrap wrap{ juce::FlexBox{}.flexWrap };
+        juce::FlexBox::JustifyContent justifyContent{ juce::FlexBox{}.justifyContent };
+        juce::FlexBox::AlignItems alignItems{ juce::FlexBox{}.alignItems };
+        juce::FlexBox::AlignContent alignContent{ juce::FlexBox{}.alignContent };
+    };
+
+    struct FlexItemValues
+    {
+        // Lengths are resolved against the bounds returned by
+        // getRelativeBoundsForFlexItem(), and are empty when auto.
+        std::optional<float> width;
+        std::optional<float> height;
+        juce::Rectangle<float> minimumBounds;
+
+        std::optional<float> idealWidth;
+        std::optional<float> idealHeight;
+
+        // Set instead of idealHeight for items whose ideal height depends on
+        // the width they're given, such as wrapped text.
+        std::function<float(float width)> calculateIdealHeight;
+
+        int order{ 0 };
+        float flexGrow{ 0.0f };
+        float flexShrink{ 1.0f };
+        float flexBasis{ 0.0f };
+        juce::FlexItem::AlignSelf alignSelf{ juce::FlexItem{}.alignSelf };
+        juce::BorderSize<float> margin;
+    };
+
+    struct GridContainerValues
+    {
+        juce::Grid::JustifyItems justifyItems{ juce::Grid{}.justifyItems };
+        juce::Grid::AlignItems alignItems{ juce::Grid{}.alignItems };
+        juce::Grid::JustifyContent justifyContent{ juce::Grid{}.justifyContent };
+        juce::Grid::AlignContent alignContent{ juce::Grid{}.alignContent };
+        juce::Grid::AutoFlow autoFlow{ juce::Grid{}.autoFlow };
+        juce::Array<juce::Grid::TrackInfo> templateColumns;
+        juce::Array<juce::Grid::TrackInfo> templateRows;
+        juce::StringArray templateAreas;
+        juce::Grid::TrackInfo autoRows{ juce::Grid{}.autoRows };
+        juce::Grid::TrackInfo autoColumns{ juce::Grid{}.autoColumns };
+        juce::Array<juce::Grid::Px> gap;
+    };
+
+    struct GridItemValues
+    {
+        // Lengths are resolved against the parent's bounds, and are empty
+        // when auto.
+        std::optional<float> width;
+        std::optional<float> height;
+        juce::Rectangle<float> minimumBounds;
+        float maxWidth{ juce::GridItem{}.maxWidth };
+        float maxHeight{ juce::GridItem{}.maxHeight };
+
+        int order{ 0 };
+        juce::GridItem::JustifySelf justifySelf{ juce::GridItem{}.justifySelf };
+        juce::GridItem::AlignSelf alignSelf{ juce::GridItem{}.alignSelf };
+        juce::GridItem::StartAndEndProperty column{ juce::GridItem{}.column };
+        juce::GridItem::StartAndEndProperty row{ juce::GridItem{}.row };
+        juce::String area;
+        juce::BorderSize<float> margin;
+    };
+
+    struct BlockItemValues
+    {
+        // Lengths are resolved against the parent's content bounds, and are
+        // empty when auto or missing.
+        std::optional<float> x;
+        std::optional<float> y;
+        std::optional<float> centreX;
+        std::optional<float> centreY;
+        std::optional<float> width;
+        std::optional<float> height;
+
+        // The item's current size, which it's centred by.
+        juce::Rectangle<float> size;
+    };
+
+    juce::FlexBox createFlexBox(const FlexContainerValues& values, LayoutStrategy strategy);
+    juce::Rectangle<float> getRelativeBoundsForFlexItem(juce::Rectangle<float> parentContentBounds,
+                                                        LayoutStrategy strategy);
+    juce::FlexItem createFlexItem(const FlexItemValues& values,
+                                  juce::Rectangle<float> parentContentBounds,
+                                  LayoutStrategy strategy,
+                                  bool isInColumn);
+
+    // Lifts the constraint along the main axis, so items are measured as if
+    // they had as much space as they wanted in the direction they flow.
+    juce::Rectangle<float> getFlexIdealSizeConstraints(juce::FlexBox::Direction direction,
+                                                       juce::Rectangle<float> constraints);
+
+    juce::Grid createGrid(const GridContainerValues& values);
+    juce::GridItem createGridItem(const GridItemValues& values);
+
+    // Lays the grid out with one-pixel auto tracks in a one-pixel space, as
+    // its ideal size is the smallest that fits its explicit tracks and items.
+    void performDummyGridLayout(juce::Grid& grid);
+
+    juce::Rectangle<int> calculateBlockItemBounds(const BlockItemValues& values,
+                                                  juce::Rectangle<float> parentContentBounds);
+
+    // Returns the size that fits the given laid-out items, including their
+    // margins, within a container's padding and border.
+    juce::Rectangle<float> calculateSizeToFit(const juce::Array<juce::FlexItem>& items,
+                                              const juce::BorderSize<float>& padding,
+                                              const juce::BorderSize<float>& border);
+    juce::Rectangle<float> calculateSizeToFit(const juce::Array<juce::GridItem>& items,
+                                              const juce::BorderSize<float>& padding,
+                                              const juce::BorderSize<float>& border);
+} // namespace jive
@@ -2,8 +2,24 @@
 
 namespace juce
 {
-    const std::unordered_map<jive::Overflow, String> VariantConverter<jive::Overflow>::stringsMap = {
-        { jive::Overflow::hidden, "hidden" },
-        { jive::Overflow::scroll, "scroll" },
-    };
+    static constexpr auto overflowKeywords = jive::KeywordTable<jive::Overflow, 2>::sort({ {
+        { "hidden", jive::Overflow::hidden },
+        { "scroll", jive::Overflow::scroll },
+    } });
+
+    const jive::KeywordTable<jive::Overflow, 2> VariantConverter<jive::Overflow>::keywords{ overflowKeywords };
+
+    jive::Overflow VariantConverter<jive::Overflow>::fromVar(const var& v)
+    {
+        if (const auto overflow = keywords.find(v))
+            return *overflow;
+
+        jassertfalse;
+        return jive::Overflow::hidden;
+    }
+
+    var VariantConverter<jive::Overflow>::toVar(const jive::Overflow& overflow)
+    {
+        return keywords.toVar(overflow);
+    }
 } // namespace juce
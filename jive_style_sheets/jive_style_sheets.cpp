@@ -1,3 +1,4 @@
 #include "jive_style_sheets.h"
 
+#include "style-sheets/jive_StyleRuleIndex.cpp"
 #include "style-sheets/jive_StyleSheet.cpp"
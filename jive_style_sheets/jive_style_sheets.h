@@ -14,4 +14,5 @@ END_JUCE_MODULE_DECLARATION */
 
 #include <jive_components/jive_components.h>
 
+#include "style-sheets/jive_StyleRuleIndex.h"
 #include "style-sheets/jive_StyleSheet.h"
@@ -0,0 +1,239 @@
+#include <jive_style_sheets/jive_style_sheets.h>
+
+namespace jive
+{
+    StyleRuleIndex& StyleRuleIndex::getInstance()
+    {
+        static StyleRuleIndex index;
+        return index;
+    }
+
+    void StyleRuleIndex::addOwner(const juce::ValueTree& owner)
+    {
+        jassert(owner.isValid());
+
+        auto& entry = owners[&owner.getProperties()];
+
+        if (entry.numReferences++ > 0)
+            return;
+
+        entry.tree = owner;
+        index(entry);
+    }
+
+    void StyleRuleIndex::removeOwner(const juce::ValueTree& owner)
+    {
+        const auto entry = owners.find(&owner.getProperties());
+
+        if (entry == std::end(owners))
+        {
+            jassertfalse;
+            return;
+        }
+
+        if (--entry->second.numReferences > 0)
+            return;
+
+        unindex(entry->second);
+        owners.erase(entry);
+    }
+
+    void StyleRuleIndex::updateOwner(const juce::ValueTree& owner)
+    {
+        if (const auto entry = owners.find(&owner.getProperties());
+            entry != std::end(owners))
+        {
+            unindex(entry->second);
+            index(entry->second);
+        }
+    }
+
+    std::vector<StyleRuleIndex::Match> StyleRuleIndex::findMatches(const juce::ValueTree& node,
+                                                                   const juce::Array<juce::Identifier>& selectors) const
+    {
+        std::vector<Match> matches;
+
+        if (numRules == 0)
+            return matches;
+
+        // Only the node's own ancestors can hold rules that match it, so the
+        // cost depends on its depth rather than on how many other trees have
+        // rules for the same selectors.
+        for (auto ancestor = node.getParent();
+             ancestor.isValid();
+             ancestor = ancestor.getParent())
+        {
+            const auto entry = owners.find(&ancestor.getProperties());
+
+            if (entry == std::end(owners) || entry->second.selectors.empty())
+                continue;
+
+            juce::Array<juce::Identifier> matchingSelectors;
+
+            for (const auto& selector : selectors)
+            {
+                if (entry->second.selectors.count(selector) > 0)
+                    matchingSelectors.add(selector);
+            }
+
+            if (!matchingSelectors.isEmpty())
+                matches.push_back({ ancestor, std::move(matchingSelectors) });
+        }
+
+        return matches;
+    }
+
+    int StyleRuleIndex::getNumOwners() const
+    {
+        return static_cast<int>(owners.size());
+    }
+
+    int StyleRuleIndex::getNumRules() const
+    {
+        return numRules;
+    }
+
+    void StyleRuleIndex::index(Owner& owner)
+    {
+        owner.selectors.clear();
+
+        // A style that's still a string is parsed through the ObjectCache, so
+        // the sheets that read it next don't have to parse it again.
+        const auto& style = owner.tree["style"];
+        const auto source = style.isString() ? ObjectCache::parseJSON(style.toString()) : style;
+        const auto* object = dynamic_cast<const Object*>(source.getDynamicObject());
+
+        if (object == nullptr)
+            return;
+
+        // Only nested objects hold rules that can match descendants.
+        for (const auto& property : object->getProperties())
+        {
+            if (dynamic_cast<Object*>(property.value.getDynamicObject()) != nullptr)
+                owner.selectors.insert(property.name);
+        }
+
+        numRules += static_cast<int>(owner.selectors.size());
+    }
+
+    void StyleRuleIndex::unindex(Owner& owner)
+    {
+        numRules -= static_cast<int>(owner.selectors.size());
+        owner.selectors.clear();
+    }
+} // namespace jive
+
+#if JIVE_UNIT_TESTS
+class StyleRuleIndexTest : public juce::UnitTest
+{
+public:
+    StyleRuleIndexTest()
+        : juce::UnitTest{ "jive::StyleRuleIndex", "jive" }
+    {
+    }
+
+    void runTest() final
+    {
+        testMatches();
+        testReferenceCounting();
+        testUpdates();
+    }
+
+private:
+    void testMatches()
+    {
+        beginTest("matches");
+
+        auto& index = jive::StyleRuleIndex::getInstance();
+
+        juce::ValueTree root{
+            "Window",
+            {
+                { "style", R"({ "Button": { "background": "#111111" }, "hover": { "background": "#222222" }, "font-size": 12 })" },
+            },
+        };
+        juce::ValueTree panel{
+            "Panel",
+            {
+                { "style", R"({ "Button": { "background": "#333333" } })" },
+            },
+        };
+        juce::ValueTree button{ "Button" };
+        root.appendChild(panel, nullptr);
+        panel.appendChild(button, nullptr);
+
+        const auto numRulesBefore = index.getNumRules();
+        index.addOwner(root);
+        index.addOwner(panel);
+        index.addOwner(button);
+        expectEquals(index.getNumRules(), numRulesBefore + 3);
+
+        auto matches = index.findMatches(button, { "Button", "Panel", "Window" });
+        expectEquals(static_cast<int>(matches.size()), 2);
+        expect(matches[0].owner == panel);
+        expect(matches[0].selectors == juce::Array<juce::Identifier>{ "Button" });
+        expect(matches[1].owner == root);
+
+        matches = index.findMatches(button, { "Button", "Panel", "Window", "hover" });
+        expect(matches[1].selectors == juce::Array<juce::Identifier>{ "Button", "hover" });
+
+        expect(index.findMatches(panel, { "Button" }).size() == 1);
+        expect(index.findMatches(root, { "Button" }).empty());
+        expect(index.findMatches(button, { "Slider" }).empty());
+
+        index.removeOwner(button);
+        index.removeOwner(panel);
+        index.removeOwner(root);
+        expectEquals(index.getNumRules(), numRulesBefore);
+        expect(index.findMatches(button, { "Button" }).empty());
+    }
+
+    void testReferenceCounting()
+    {
+        beginTest("reference counting");
+
+        auto& index = jive::StyleRuleIndex::getInstance();
+        juce::ValueTree root{ "Window", { { "style", R"({ "Button": {} })" } } };
+        juce::ValueTree button{ "Button" };
+        root.appendChild(button, nullptr);
+
+        const auto numOwnersBefore = index.getNumOwners();
+        index.addOwner(root);
+        index.addOwner(root);
+        expectEquals(index.getNumOwners(), numOwnersBefore + 1);
+
+        index.removeOwner(root);
+        expect(index.findMatches(button, { "Button" }).size() == 1);
+
+        index.removeOwner(root);
+        expect(index.findMatches(button, { "Button" }).empty());
+        expectEquals(index.getNumOwners(), numOwnersBefore);
+    }
+
+    void testUpdates()
+    {
+        beginTest("updates");
+
+        auto& index = jive::StyleRuleIndex::getInstance();
+        juce::ValueTree root{ "Window" };
+        juce::ValueTree button{ "Button" };
+        root.appendChild(button, nullptr);
+
+        index.addOwner(root);
+        expect(index.findMatches(button, { "Button" }).empty());
+
+        root.setProperty("style", R"({ "Button": { "background": "#111111" } })", nullptr);
+        index.updateOwner(root);
+        expect(index.findMatches(button, { "Button" }).size() == 1);
+
+        root.setProperty("style", R"({ "Slider": { "background": "#111111" } })", nullptr);
+        index.updateOwner(root);
+        expect(index.findMatches(button, { "Button" }).empty());
+        expect(index.findMatches(button, { "Slider" }).size() == 1);
+
+        index.removeOwner(root);
+    }
+};
+
+static StyleRuleIndexTest styleRuleIndexTest;
+#endif
@@ -0,0 +1,61 @@
+#pragma once
+
+namespace jive
+{
+    // Keeps the selectors (types or states such as "Button" or "hover") that
+    // each tree's style object holds rules for, so the rules that could match
+    // a node can be found with a lookup per ancestor rather than by searching
+    // each ancestor's style for each selector.
+    //
+    // Each tree with a style sheet adds its own tree, and any ancestors
+    // between it and the closest sheet above, as owners.
+    class StyleRuleIndex
+    {
+    public:
+        struct Match
+        {
+            juce::ValueTree owner;
+
+            // The selectors the owner's style has rules for, in the order
+            // they were given.
+            juce::Array<juce::Identifier> selectors;
+        };
+
+        static StyleRuleIndex& getInstance();
+
+        // Owners are reference-counted, so a tree shared by several sheets
+        // stays indexed until the last of them removes it.
+        void addOwner(const juce::ValueTree& owner);
+        void removeOwner(const juce::ValueTree& owner);
+
+        // Compiles the rules in the owner's style again, e.g. after its style
+        // changed.
+        void updateOwner(const juce::ValueTree& owner);
+
+        // Returns the ancestors of the given node with rules for any of the
+        // given selectors, nearest first.
+        std::vector<Match> findMatches(const juce::ValueTree& node,
+                                       const juce::Array<juce::Identifier>& selectors) const;
+
+        int getNumOwners() const;
+        int getNumRules() const;
+
+    private:
+        struct Owner
+        {
+            juce::ValueTree tree;
+            std::unordered_set<juce::Identifier> selectors;
+            int numReferences{ 0 };
+        };
+
+        StyleRuleIndex() = default;
+
+        void index(Owner& owner);
+        void unindex(Owner& owner);
+
+        std::unordered_map<const juce::NamedValueSet*, Owner> owners;
+        int numRules{ 0 };
+
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(StyleRuleIndex)
+    };
+} // namespace jive
@@ -23,19 +23,25 @@ namespace jive
         };
     } // namespace fontProperties
 
-    juce::StringArray getAncestorTypes(const juce::ValueTree& child)
+    namespace styleProperties
     {
-        juce::StringArray types;
-
-        for (auto parent = child.getParent();
-             parent.isValid();
-             parent = parent.getParent())
-        {
-            types.add(parent.getType().toString());
-        }
-
-        return types;
-    }
+        static const juce::Identifier style{ "style" };
+        static const juce::Identifier background{ "background" };
+        static const juce::Identifier foreground{ "foreground" };
+        static const juce::Identifier border{ "border" };
+        static const juce::Identifier borderRadius{ "border-radius" };
+
+        static const juce::Array hereditary{
+            foreground,
+            fontProperties::fontFamily,
+            fontProperties::fontStyle,
+            fontProperties::fontWeight,
+            fontProperties::fontSize,
+            fontProperties::letterSpacing,
+            fontProperties::textDecoration,
+            fontProperties::fontStretch,
+        };
+    } // namespace styleProperties
 
     struct StyleSheet::Selectors
     {
@@ -47,6 +53,8 @@ namespace jive
             , keyboard{ state, keyboardID }
         {
             const auto informListeners = [this]() {
+                needsCompiling = true;
+
                 if (onChange != nullptr)
                     onChange();
             };
@@ -55,41 +63,74 @@ namespace jive
             keyboard.onValueChange = informListeners;
         }
 
-        juce::StringArray getSelectorsInOrderOfSpecificity() const
+        // Compiled on first use and kept until the interaction state changes
+        // or the tree is moved, rather than being built for every lookup.
+        const juce::Array<juce::Identifier>& getSelectorsInOrderOfSpecificity() const
+        {
+            if (needsCompiling)
+                compile();
+
+            return compiled;
+        }
+
+        // Called when the tree or one of its ancestors is moved, as the types
+        // of its ancestors may have changed.
+        void ancestorsChanged()
+        {
+            needsCompiling = true;
+        }
+
+        std::function<void()> onChange = nullptr;
+
+    private:
+        void compile() const
         {
-            juce::StringArray result{ state.getType() };
-            result.addArray(getAncestorTypes(state));
+            compiled.clearQuick();
+            compiled.add(state.getType());
+
+            // An ancestor type that's already listed can't match anything the
+            // first occurrence didn't, so each type is only listed once.
+            for (auto parent = state.getParent();
+                 parent.isValid();
+                 parent = parent.getParent())
+            {
+                compiled.addIfNotAlreadyThere(parent.getType());
+            }
 
             if (!enabled.get())
-                result.add("disabled");
+                compiled.add(disabledSelector);
             if (keyboard == ComponentInteractionState::Keyboard::focus)
-                result.add("focus");
+                compiled.add(focusSelector);
             if (mouse == ComponentInteractionState::Mouse::active)
-                result.add("active");
+                compiled.add(activeSelector);
             if (mouse != ComponentInteractionState::Mouse::dissociate)
-                result.add("hover");
+                compiled.add(hoverSelector);
 
-            return result;
+            needsCompiling = false;
         }
 
-        std::function<void()> onChange = nullptr;
-
-    private:
         static const inline juce::Identifier enabledID{ "enabled" };
         static const inline juce::Identifier mouseID{ "mouse" };
         static const inline juce::Identifier keyboardID{ "keyboard" };
 
+        static const inline juce::Identifier disabledSelector{ "disabled" };
+        static const inline juce::Identifier focusSelector{ "focus" };
+        static const inline juce::Identifier activeSelector{ "active" };
+        static const inline juce::Identifier hoverSelector{ "hover" };
+
         juce::ValueTree state;
         Property<bool> enabled;
         Property<ComponentInteractionState::Mouse> mouse;
         Property<ComponentInteractionState::Keyboard> keyboard;
+
+        mutable juce::Array<juce::Identifier> compiled;
+        mutable bool needsCompiling{ true };
     };
 
     StyleSheet::StyleSheet(juce::Component& sourceComponent,
                            juce::ValueTree sourceState)
         : component{ &sourceComponent }
         , state{ sourceState }
-        , stateRoot{ state.getRoot() }
         , interactionState{ sourceComponent, state }
         , style{ state, "style" }
         , borderWidth{ state, "border-width" }
@@ -102,23 +143,22 @@ namespace jive
         component->addAndMakeVisible(backgroundCanvas, 0);
         backgroundCanvas.setBounds(component->getLocalBounds());
 
-        applyStyles();
+        subscribeToStyleChanges();
+        applyStyles(Cascade::inheritedChanges);
 
         component->addComponentListener(this);
-        stateRoot.addListener(this);
 
         borderWidth.onValueChange = [this]() {
             backgroundCanvas.setBorderWidth(borderWidth.get());
         };
 
-        if (auto object = style.get();
-            object != nullptr)
-        {
-            object->addListener(*this);
-        }
+        observeStyleObject();
 
+        // A node's interaction state only affects which of its own rules
+        // match, so its descendants only need restyling if what they inherit
+        // from it changed.
         selectors->onChange = [this]() {
-            applyStyles();
+            applyStyles(Cascade::inheritedChanges);
         };
     }
 
@@ -130,75 +170,89 @@ namespace jive
             component->getProperties().remove("style-sheet");
         }
 
-        if (auto object = style.get();
-            object != nullptr)
-        {
-            object->removeListener(*this);
-        }
+        if (observedStyle != nullptr)
+            observedStyle->removeListener(*this);
+
+        unsubscribeFromStyleChanges();
     }
 
     Fill StyleSheet::getBackground() const
     {
-        return juce::VariantConverter<Fill>::fromVar(findStyleProperty("background"));
+        return getComputedStyle().background;
     }
 
     Fill StyleSheet::getForeground() const
     {
-        return juce::VariantConverter<Fill>::fromVar(findHierarchicalStyleProperty("foreground"));
+        return getComputedStyle().foreground;
     }
 
     Fill StyleSheet::getBorderFill() const
     {
-        return juce::VariantConverter<Fill>::fromVar(findStyleProperty("border"));
+        return getComputedStyle().borderFill;
     }
 
     BorderRadii<float> StyleSheet::getBorderRadii() const
     {
-        return juce::VariantConverter<BorderRadii<float>>::fromVar(findStyleProperty("border-radius"));
+        return getComputedStyle().borderRadii;
     }
 
     juce::Font StyleSheet::getFont() const
+    {
+        return getComputedStyle().font;
+    }
+
+    int StyleSheet::getNumStylesApplied()
+    {
+        return getNumStylesAppliedCounter();
+    }
+
+    void StyleSheet::resetNumStylesApplied()
+    {
+        getNumStylesAppliedCounter() = 0;
+    }
+
+    static juce::Font createFont(const juce::NamedValueSet& fontValues)
     {
         juce::Font font;
 
-        if (const auto fontFamily = findHierarchicalStyleProperty(fontProperties::fontFamily).toString();
+        if (const auto fontFamily = fontValues[fontProperties::fontFamily].toString();
             fontFamily.isNotEmpty())
         {
             font.setTypefaceName(fontFamily);
         }
 
-        if (const auto fontStyle = findHierarchicalStyleProperty(fontProperties::fontStyle).toString();
+        if (const auto fontStyle = fontValues[fontProperties::fontStyle].toString();
             fontStyle.isNotEmpty())
         {
             font.setItalic(fontStyle.compareIgnoreCase("italic") == 0);
         }
 
-        if (const auto weight = findHierarchicalStyleProperty(fontProperties::fontWeight).toString();
+        if (const auto weight = fontValues[fontProperties::fontWeight].toString();
             weight.isNotEmpty())
         {
             font.setBold(weight.compareIgnoreCase("bold") == 0);
         }
 
-        if (const auto size = findHierarchicalStyleProperty(fontProperties::fontSize);
+        if (const auto size = fontValues[fontProperties::fontSize];
             size != juce::var{})
         {
             font = font.withPointHeight(static_cast<float>(size));
         }
 
-        if (const auto spacing = findHierarchicalStyleProperty(fontProperties::letterSpacing);
+        if (const auto spacing = fontValues[fontProperties::letterSpacing];
             spacing != juce::var{})
         {
             const auto extraKerning = static_cast<float>(spacing) / font.getHeight();
             font.setExtraKerningFactor(extraKerning);
         }
 
-        if (const auto decoration = findHierarchicalStyleProperty(fontProperties::textDecoration).toString();
+        if (const auto decoration = fontValues[fontProperties::textDecoration].toString();
             decoration.isNotEmpty())
         {
             font.setUnderline(decoration.compareIgnoreCase("underlined") == 0);
         }
 
-        if (const auto stretch = findHierarchicalStyleProperty(fontProperties::fontStretch);
+        if (const auto stretch = fontValues[fontProperties::fontStretch];
             stretch != juce::var{})
         {
             font.setHorizontalScale(static_cast<float>(stretch));
@@ -218,27 +272,51 @@ namespace jive
     void StyleSheet::componentParentHierarchyChanged(juce::Component& childComponent)
     {
         jassertquiet(&childComponent == component);
-        applyStyles();
+        subscribeToStyleChanges();
+
+        // Every component beneath the one that moved is told about it, parents
+        // first, so each sheet beneath will restyle itself.
+        applyStyles(Cascade::inheritedChanges);
     }
 
-    void StyleSheet::valueTreePropertyChanged(juce::ValueTree&, const juce::Identifier& id)
+    void StyleSheet::valueTreePropertyChanged(juce::ValueTree& tree, const juce::Identifier& id)
     {
-        if (id == juce::Identifier{ "style" })
-        {
-            if (auto object = style.get();
-                object != nullptr)
-            {
-                object->addListener(*this);
-            }
+        jassertquiet(id == styleProperties::style);
 
-            applyStyles();
-        }
+        StyleRuleIndex::getInstance().updateOwner(tree);
+        observeStyleObject();
+        applyStyles(Cascade::allDescendants);
     }
 
-    void StyleSheet::propertyChanged(Object& object, const juce::Identifier&)
+    void StyleSheet::valueTreeParentChanged(juce::ValueTree&)
     {
-        jassertquiet(&object == style.get().get());
-        applyStyles();
+        // The dispatcher for this sheet's own tree is told whenever it or any
+        // of its ancestors is moved.
+        selectors->ancestorsChanged();
+
+        if (component == nullptr)
+            return;
+
+        subscribeToStyleChanges();
+
+        // The types of the ancestors of this tree, and of every tree beneath
+        // it, may have changed, so any of their rules could now match.
+        applyStyles(Cascade::allDescendants);
+    }
+
+    void StyleSheet::propertyChanged(Object& object, const juce::Identifier& name)
+    {
+        jassertquiet(&object == observedStyle.get());
+
+        // Only nested objects hold rules that can match descendants. A
+        // removed property may have been one.
+        const auto& value = object.getProperty(name);
+        const auto couldMatchDescendants = value.isVoid() || value.getDynamicObject() != nullptr;
+
+        if (couldMatchDescendants)
+            StyleRuleIndex::getInstance().updateOwner(state);
+
+        applyStyles(couldMatchDescendants ? Cascade::allDescendants : Cascade::inheritedChanges);
     }
 
     enum class StyleSearchStrategy
@@ -274,6 +352,18 @@ namespace jive
             return juce::var{};
     }
 
+    static Object::ReferenceCountedPointer getStyleObject(const juce::ValueTree& state)
+    {
+        const auto& style = state[styleProperties::style];
+
+        // Styles are only stored as strings until a Property first parses
+        // them, so most lookups can skip creating one.
+        if (style.isString())
+            return Property<Object::ReferenceCountedPointer>{ state, styleProperties::style }.get();
+
+        return juce::VariantConverter<Object::ReferenceCountedPointer>::fromVar(style);
+    }
+
     template <StyleSearchStrategy strategy>
     juce::var findStyleProperty(const juce::ValueTree& state,
                                 const StyleSheet::Selectors& selectors,
@@ -281,7 +371,7 @@ namespace jive
     {
         jassert(state.isValid());
 
-        if (auto object = Property<Object::ReferenceCountedPointer>{ state, "style" }.get())
+        if (auto object = getStyleObject(state))
         {
             return findStyleProperty<strategy>(*object.get(),
                                                selectors,
@@ -301,16 +391,31 @@ namespace jive
             return value;
         }
 
-        for (auto stateToSearch = state.getParent();
-             stateToSearch.isValid();
-             stateToSearch = stateToSearch.getParent())
+        // Rather than searching every ancestor's style for each selector, the
+        // index gives the ancestors with rules for any of them, nearest first.
+        const auto& selectorsInOrder = selectors->getSelectorsInOrderOfSpecificity();
+
+        for (const auto& match : StyleRuleIndex::getInstance().findMatches(state, selectorsInOrder))
         {
-            if (auto value = ::jive::findStyleProperty<StyleSearchStrategy::childrenOnly>(stateToSearch,
-                                                                                          *selectors,
-                                                                                          propertyName);
-                value != juce::var{})
+            const auto object = getStyleObject(match.owner);
+
+            if (object == nullptr)
+                continue;
+
+            for (const auto& selector : match.selectors)
             {
-                return value;
+                const auto* nested = dynamic_cast<const Object*>(object->getProperty(selector).getDynamicObject());
+
+                if (nested == nullptr)
+                    continue;
+
+                if (auto value = ::jive::findStyleProperty<StyleSearchStrategy::objectAndChildren>(*nested,
+                                                                                                   *selectors,
+                                                                                                   propertyName);
+                    value != juce::var{})
+                {
+                    return value;
+                }
             }
         }
 
@@ -319,23 +424,23 @@ namespace jive
 
     juce::var StyleSheet::findHierarchicalStyleProperty(const juce::Identifier& propertyName) const
     {
-        for (juce::ReferenceCountedObjectPtr<StyleSheet> styleSheetToSearch{ const_cast<StyleSheet*>(this) };
-             styleSheetToSearch != nullptr;
-             styleSheetToSearch = styleSheetToSearch->findClosestAncestorStyleSheet())
+        if (auto value = ::jive::findStyleProperty<StyleSearchStrategy::objectAndChildren>(state,
+                                                                                           *selectors,
+                                                                                           propertyName);
+            value != juce::var{})
         {
-            if (auto value = ::jive::findStyleProperty<StyleSearchStrategy::objectAndChildren>(styleSheetToSearch->state,
-                                                                                               *styleSheetToSearch->selectors,
-                                                                                               propertyName);
-                value != juce::var{})
-            {
-                return value;
-            }
+            return value;
         }
 
+        // The closest ancestor's computed style already holds whatever it
+        // inherited, so there's no need to search any further up.
+        if (const auto parentSheet = findClosestAncestorStyleSheet())
+            return parentSheet->getComputedStyle().hereditaryValues[propertyName];
+
         return {};
     }
 
-    juce::ReferenceCountedObjectPtr<StyleSheet> StyleSheet::findClosestAncestorStyleSheet()
+    juce::ReferenceCountedObjectPtr<StyleSheet> StyleSheet::findClosestAncestorStyleSheet() const
     {
         for (auto* parent = component->getParentComponent();
              parent != nullptr;
@@ -366,27 +471,139 @@ namespace jive
         return result;
     }
 
-    void StyleSheet::applyStyles()
+    const StyleSheet::ComputedStyle& StyleSheet::getComputedStyle() const
     {
-        backgroundCanvas.setFill(getBackground());
-        backgroundCanvas.setBorderFill(getBorderFill());
-        backgroundCanvas.setBorderWidth(borderWidth.get());
-        backgroundCanvas.setBorderRadii(getBorderRadii());
+        if (!computedStyle.has_value())
+            computedStyle = computeStyle();
+
+        return *computedStyle;
+    }
+
+    StyleSheet::ComputedStyle StyleSheet::computeStyle() const
+    {
+        ComputedStyle result;
+
+        result.background = juce::VariantConverter<Fill>::fromVar(findStyleProperty(styleProperties::background));
+        result.borderFill = juce::VariantConverter<Fill>::fromVar(findStyleProperty(styleProperties::border));
+        result.borderRadii = juce::VariantConverter<BorderRadii<float>>::fromVar(findStyleProperty(styleProperties::borderRadius));
+
+        for (const auto& propertyName : styleProperties::hereditary)
+            result.hereditaryValues.set(propertyName, findHierarchicalStyleProperty(propertyName));
+
+        result.foreground = juce::VariantConverter<Fill>::fromVar(result.hereditaryValues[styleProperties::foreground]);
+        result.font = createFont(result.hereditaryValues);
+
+        return result;
+    }
+
+    void StyleSheet::observeStyleObject()
+    {
+        auto object = style.get();
+
+        if (object == observedStyle)
+            return;
 
-        if (auto* text = dynamic_cast<TextComponent*>(component.getComponent()))
+        if (observedStyle != nullptr)
+            observedStyle->removeListener(*this);
+
+        observedStyle = object;
+
+        if (observedStyle != nullptr)
+            observedStyle->addListener(*this);
+    }
+
+    void StyleSheet::subscribeToStyleChanges()
+    {
+        // Only the styles of a tree and its descendants can depend on it, and
+        // applying the styles cascades down to every sheet beneath, so each
+        // sheet only needs to hear about changes to its own tree and any
+        // ancestors between it and the closest sheet above it.
+        const auto parentSheet = findClosestAncestorStyleSheet();
+        std::vector<PropertyDispatcher::ReferenceCountedPointer> dispatchers;
+
+        for (auto tree = state;
+             tree.isValid() && (parentSheet == nullptr || tree != parentSheet->state);
+             tree = tree.getParent())
         {
-            text->setTextColour(*getForeground().getColour());
-            text->setFont(getFont());
+            dispatchers.push_back(PropertyDispatcher::getDispatcherFor(tree));
         }
-        if (state.getType().toString().compareIgnoreCase("svg") == 0)
+
+        if (dispatchers == styleDispatchers)
+            return;
+
+        unsubscribeFromStyleChanges();
+        styleDispatchers = std::move(dispatchers);
+
+        // The same trees' rules are indexed, so descendants can find them.
+        for (auto& dispatcher : styleDispatchers)
+        {
+            dispatcher->subscribe(styleProperties::style,
+                                  *this,
+                                  PropertyDispatcher::Scope::thisTreeOnly);
+            StyleRuleIndex::getInstance().addOwner(dispatcher->getTree());
+        }
+    }
+
+    void StyleSheet::unsubscribeFromStyleChanges()
+    {
+        for (auto& dispatcher : styleDispatchers)
+        {
+            dispatcher->unsubscribe(styleProperties::style,
+                                    *this,
+                                    PropertyDispatcher::Scope::thisTreeOnly);
+            StyleRuleIndex::getInstance().removeOwner(dispatcher->getTree());
+        }
+
+        styleDispatchers.clear();
+    }
+
+    void StyleSheet::applyStyles(Cascade cascade)
+    {
+        getNumStylesAppliedCounter()++;
+
+        // The child sheets are applied after this one, so they inherit from
+        // the freshly computed style rather than searching any further up.
+        const auto previous = std::exchange(computedStyle, std::nullopt);
+        const auto& computed = getComputedStyle();
+
+        if (!previous.has_value() || computed.background != previous->background)
+            backgroundCanvas.setFill(computed.background);
+        if (!previous.has_value() || computed.borderFill != previous->borderFill)
+            backgroundCanvas.setBorderFill(computed.borderFill);
+        if (!previous.has_value() || computed.borderRadii != previous->borderRadii)
+            backgroundCanvas.setBorderRadii(computed.borderRadii);
+
+        backgroundCanvas.setBorderWidth(borderWidth.get());
+
+        const auto inheritedValuesChanged = !previous.has_value()
+                                         || computed.hereditaryValues != previous->hereditaryValues;
+
+        if (inheritedValuesChanged)
         {
-            state.setProperty("fill",
-                              "#" + getForeground().getColour()->toDisplayString(false),
-                              nullptr);
+            if (auto* text = dynamic_cast<TextComponent*>(component.getComponent()))
+            {
+                text->setTextColour(*computed.foreground.getColour());
+                text->setFont(computed.font);
+            }
+            if (state.getType().toString().compareIgnoreCase("svg") == 0)
+            {
+                state.setProperty("fill",
+                                  "#" + computed.foreground.getColour()->toDisplayString(false),
+                                  nullptr);
+            }
         }
 
+        if (!inheritedValuesChanged && cascade == Cascade::inheritedChanges)
+            return;
+
         for (auto child : collectChildSheets())
-            child->applyStyles();
+            child->applyStyles(cascade);
+    }
+
+    int& StyleSheet::getNumStylesAppliedCounter()
+    {
+        static int numStylesApplied = 0;
+        return numStylesApplied;
     }
 } // namespace jive
 
@@ -433,6 +650,11 @@ public:
     #endif
 
         testFont();
+        testComputedStyle();
+        testRestyle();
+        testReparenting();
+        testAncestorStyleChanges();
+        testUnrelatedChanges();
     }
 
 private:
@@ -663,7 +885,458 @@ private:
         expected.setHorizontalScale(0.381f);
         expectEquals(text.getFont(), expected);
     }
+
+    void testComputedStyle()
+    {
+        beginTest("computed style");
+
+        juce::ValueTree state{
+            "Component",
+            {
+                { "style", R"({ "foreground": "#111111", "font-size": 20 })" },
+            },
+            {
+                juce::ValueTree{ "Text" },
+                juce::ValueTree{ "Component" },
+            },
+        };
+        juce::Component parent;
+        jive::TextComponent text;
+        juce::Component sibling;
+        parent.addAndMakeVisible(text);
+        parent.addAndMakeVisible(sibling);
+
+        jive::StyleSheet::ReferenceCountedPointer parentSheet = new jive::StyleSheet{ parent, state };
+        jive::StyleSheet::ReferenceCountedPointer textSheet = new jive::StyleSheet{ text, state.getChild(0) };
+        jive::StyleSheet::ReferenceCountedPointer siblingSheet = new jive::StyleSheet{ sibling, state.getChild(1) };
+        expect(textSheet->getForeground().getColour() == juce::Colour{ 0xFF111111 });
+        expectEquals(textSheet->getFont(), juce::Font{}.withPointHeight(20.0f));
+        expectEquals(text.getFont(), juce::Font{}.withPointHeight(20.0f));
+
+        jive::Property<jive::Object::ReferenceCountedPointer> style{ state, "style" };
+        style.get()->setProperty("foreground", "#222222");
+        expect(textSheet->getForeground().getColour() == juce::Colour{ 0xFF222222 });
+        expect(siblingSheet->getForeground().getColour() == juce::Colour{ 0xFF222222 });
+
+        state.getChild(0).setProperty("style",
+                                      R"({ "hover": { "foreground": "#333333" }, "font-size": 10 })",
+                                      nullptr);
+        expect(textSheet->getForeground().getColour() == juce::Colour{ 0xFF222222 });
+        expectEquals(text.getFont(), juce::Font{}.withPointHeight(10.0f));
+
+        state.getChild(0).setProperty("mouse", "hover", nullptr);
+        expect(textSheet->getForeground().getColour() == juce::Colour{ 0xFF333333 });
+        expect(siblingSheet->getForeground().getColour() == juce::Colour{ 0xFF222222 });
+
+        state.getChild(0).setProperty("mouse", "dissociate", nullptr);
+        state.setProperty("style",
+                          R"({ "foreground": "#444444", "Component": { "background": "#555555" } })",
+                          nullptr);
+        expect(textSheet->getForeground().getColour() == juce::Colour{ 0xFF444444 });
+        expect(siblingSheet->getForeground().getColour() == juce::Colour{ 0xFF444444 });
+        expect(siblingSheet->getBackground().getColour() == juce::Colour{ 0xFF555555 });
+    }
+
+    void testRestyle()
+    {
+        beginTest("restyle");
+
+        juce::ValueTree state{
+            "Component",
+            {
+                { "style", R"({ "foreground": "#111111", "hover": { "background": "#AA0000" } })" },
+            },
+            {
+                juce::ValueTree{ "Text" },
+            },
+        };
+        juce::Component parent;
+        jive::TextComponent text;
+        parent.addAndMakeVisible(text);
+
+        jive::StyleSheet::ReferenceCountedPointer parentSheet = new jive::StyleSheet{ parent, state };
+        jive::StyleSheet::ReferenceCountedPointer textSheet = new jive::StyleSheet{ text, state.getChild(0) };
+
+        // Hovering the parent only changes its own background, so only its
+        // own styles should be applied again, and not the text's.
+        jive::StyleSheet::resetNumStylesApplied();
+        state.setProperty("mouse", "hover", nullptr);
+        expectEquals(jive::StyleSheet::getNumStylesApplied(), 1);
+        expect(parentSheet->getBackground().getColour() == juce::Colour{ 0xFFAA0000 });
+        expect(textSheet->getForeground().getColour() == juce::Colour{ 0xFF111111 });
+
+        jive::Property<jive::Object::ReferenceCountedPointer> style{ state, "style" };
+        style.get()->setProperty("hover", jive::parseJSON(R"({ "foreground": "#222222" })"));
+        expect(textSheet->getForeground().getColour() == juce::Colour{ 0xFF222222 });
+
+        // Now the foreground the text inherits changes as well.
+        jive::StyleSheet::resetNumStylesApplied();
+        state.setProperty("mouse", "dissociate", nullptr);
+        expectEquals(jive::StyleSheet::getNumStylesApplied(), 2);
+        expect(textSheet->getForeground().getColour() == juce::Colour{ 0xFF111111 });
+
+        style.get()->setProperty("Text", jive::parseJSON(R"({ "background": "#333333" })"));
+        expect(textSheet->getBackground().getColour() == juce::Colour{ 0xFF333333 });
+        expect(parentSheet->getBackground() != textSheet->getBackground());
+
+        style.get()->removeProperty("Text");
+        expect(textSheet->getBackground().getColour() != juce::Colour{ 0xFF333333 });
+    }
+
+    void testReparenting()
+    {
+        beginTest("reparenting");
+
+        juce::ValueTree state{
+            "Window",
+            {
+                { "style", R"({ "Panel": { "Button": { "background": "#111111" } }, "Dialog": { "Button": { "background": "#222222" } } })" },
+            },
+            {
+                juce::ValueTree{ "Panel", {}, { juce::ValueTree{ "Button" } } },
+                juce::ValueTree{ "Dialog" },
+            },
+        };
+        juce::Component window;
+        juce::Component panel;
+        juce::Component dialog;
+        juce::Component button;
+        window.addAndMakeVisible(panel);
+        window.addAndMakeVisible(dialog);
+        panel.addAndMakeVisible(button);
+
+        jive::StyleSheet::ReferenceCountedPointer windowSheet = new jive::StyleSheet{ window, state };
+        jive::StyleSheet::ReferenceCountedPointer buttonSheet = new jive::StyleSheet{ button, state.getChild(0).getChild(0) };
+        expect(buttonSheet->getBackground().getColour() == juce::Colour{ 0xFF111111 });
+
+        auto buttonState = state.getChild(0).getChild(0);
+        state.getChild(0).removeChild(buttonState, nullptr);
+        state.getChild(1).appendChild(buttonState, nullptr);
+        expect(buttonSheet->getBackground().getColour() == juce::Colour{ 0xFF222222 });
+
+        dialog.addAndMakeVisible(button);
+        expect(buttonSheet->getBackground().getColour() == juce::Colour{ 0xFF222222 });
+    }
+
+    void testAncestorStyleChanges()
+    {
+        beginTest("ancestor style changes");
+
+        juce::ValueTree state{
+            "Window",
+            {
+                { "style", R"({ "foreground": "#111111" })" },
+            },
+            {
+                juce::ValueTree{ "Group", {}, { juce::ValueTree{ "Button" } } },
+            },
+        };
+        juce::Component window;
+        juce::Component button;
+        window.addAndMakeVisible(button);
+
+        // The group between the two sheets doesn't have one of its own.
+        jive::StyleSheet::ReferenceCountedPointer windowSheet = new jive::StyleSheet{ window, state };
+        jive::StyleSheet::ReferenceCountedPointer buttonSheet = new jive::StyleSheet{ button, state.getChild(0).getChild(0) };
+        expect(buttonSheet->getBackground().getColour() == juce::Colour{ 0x00000000 });
+
+        state.getChild(0).setProperty("style",
+                                      R"({ "Button": { "background": "#333333" } })",
+                                      nullptr);
+        expect(buttonSheet->getBackground().getColour() == juce::Colour{ 0xFF333333 });
+        expect(buttonSheet->getForeground().getColour() == juce::Colour{ 0xFF111111 });
+        expect(windowSheet->getBackground().getColour() == juce::Colour{ 0x00000000 });
+
+        state.getChild(0).removeProperty("style", nullptr);
+        expect(buttonSheet->getBackground().getColour() == juce::Colour{ 0x00000000 });
+    }
+
+    void testUnrelatedChanges()
+    {
+        beginTest("unrelated changes");
+
+        juce::ValueTree state{
+            "Window",
+            {
+                { "style", R"({ "Button": { "background": "#111111" } })" },
+            },
+            {
+                juce::ValueTree{ "Group", {}, { juce::ValueTree{ "Button" } } },
+            },
+        };
+        juce::Component window;
+        juce::Component button;
+        window.addAndMakeVisible(button);
+
+        jive::StyleSheet::ReferenceCountedPointer windowSheet = new jive::StyleSheet{ window, state };
+        jive::StyleSheet::ReferenceCountedPointer buttonSheet = new jive::StyleSheet{ button, state.getChild(0).getChild(0) };
+        jive::StyleSheet::resetNumStylesApplied();
+
+        for (auto tree : { state, state.getChild(0), state.getChild(0).getChild(0) })
+        {
+            tree.setProperty("width", 100, nullptr);
+            tree.setProperty("ideal-width", 50, nullptr);
+            tree.setProperty("value", 0.5, nullptr);
+            tree.setProperty("text", "Unrelated", nullptr);
+        }
+
+        expectEquals(jive::StyleSheet::getNumStylesApplied(), 0);
+        expect(buttonSheet->getBackground().getColour() == juce::Colour{ 0xFF111111 });
+    }
 };
 
 static StyleSheetTest styleSheetTest;
+
+class StyleSheetBenchmark : public juce::UnitTest
+{
+public:
+    StyleSheetBenchmark()
+        : juce::UnitTest{ "jive::StyleSheet", "jive-micro-benchmarks" }
+    {
+    }
+
+    void runTest() final
+    {
+        benchmarkNestedRestyle();
+        benchmarkTheme();
+
+        // Hovering over an item should cost the same however big the rest
+        // of the document is.
+        const auto smallViewSeconds = benchmarkHover(500);
+        const auto largeViewSeconds = benchmarkHover(5000);
+        logMessage("Hovering in 5000 sheets took " + juce::String{ largeViewSeconds / smallViewSeconds, 2 }
+                   + "x as long as in 500");
+
+        // Nor should it depend on how many other items have rules for the
+        // same states.
+        const auto fewRulesSeconds = benchmarkOwnStateRules(500);
+        const auto manyRulesSeconds = benchmarkOwnStateRules(5000);
+        logMessage("Hovering among 5000 sheets with their own state rules took "
+                   + juce::String{ manyRulesSeconds / fewRulesSeconds, 2 } + "x as long as among 500");
+    }
+
+private:
+    void benchmarkNestedRestyle()
+    {
+        beginTest("restyle " + juce::String{ depth } + " nested sheets");
+
+        juce::ValueTree state{
+            "Panel",
+            {
+                { "style", R"({
+                    "foreground": "#101010",
+                    "font-size": 13,
+                    "Panel": { "border-radius": 2 },
+                    "Button": { "background": "#202020", "hover": { "background": "#303030" } },
+                    "Knob": { "border": "#404040" },
+                    "disabled": { "foreground": "#505050" },
+                    "hover": { "background": "#606060" }
+                })" },
+            },
+        };
+        std::vector<std::unique_ptr<juce::Component>> components;
+        std::vector<jive::StyleSheet::ReferenceCountedPointer> sheets;
+
+        components.push_back(std::make_unique<juce::Component>());
+        sheets.push_back(new jive::StyleSheet{ *components.back(), state });
+
+        for (auto parent = state; static_cast<int>(components.size()) < depth;)
+        {
+            juce::ValueTree child{
+                components.size() % 3 == 0 ? "Button" : "Panel",
+                {
+                    { "enabled", true },
+                    { "style", R"({ "letter-spacing": 1 })" },
+                },
+            };
+            parent.appendChild(child, nullptr);
+
+            auto component = std::make_unique<juce::Component>();
+            components.back()->addAndMakeVisible(*component);
+            components.push_back(std::move(component));
+            sheets.push_back(new jive::StyleSheet{ *components.back(), child });
+
+            parent = child;
+        }
+
+        jive::Property<jive::Object::ReferenceCountedPointer> style{ state, "style" };
+        const auto start = juce::Time::getHighResolutionTicks();
+
+        for (auto i = 0; i < numRestyles; i++)
+            style.get()->setProperty("foreground", i % 2 == 0 ? "#111111" : "#121212");
+
+        const auto seconds = juce::Time::highResolutionTicksToSeconds(juce::Time::getHighResolutionTicks() - start);
+        logMessage(juce::String{ seconds * 1.0e3 / numRestyles, 3 } + "ms per restyle of "
+                   + juce::String{ depth } + " nested sheets");
+
+        expect(sheets.back()->getForeground().getColour() == juce::Colour{ 0xFF121212 });
+
+        // Hovering the outermost panel only changes its own background, so
+        // none of the sheets beneath it should need restyling.
+        const auto hoverStart = juce::Time::getHighResolutionTicks();
+
+        for (auto i = 0; i < numRestyles; i++)
+            state.setProperty("mouse", i % 2 == 0 ? "hover" : "dissociate", nullptr);
+
+        const auto hoverSeconds = juce::Time::highResolutionTicksToSeconds(juce::Time::getHighResolutionTicks() - hoverStart);
+        logMessage(juce::String{ hoverSeconds * 1.0e3 / numRestyles, 3 } + "ms per hover of the outermost of "
+                   + juce::String{ depth } + " nested sheets");
+
+        sheets.clear();
+    }
+
+    void benchmarkTheme()
+    {
+        beginTest("apply a theme of " + juce::String{ numThemeRules } + " rules to "
+                  + juce::String{ numThemedSheets } + " sheets");
+
+        auto theme = std::make_unique<jive::Object>();
+
+        for (auto i = 0; i < numThemeRules; i++)
+        {
+            auto rule = std::make_unique<jive::Object>();
+            rule->setProperty("background", "#" + juce::String::toHexString(0x100000 + i));
+            theme->setProperty("Type" + juce::String{ i }, rule.release());
+        }
+
+        juce::ValueTree state{ "Window" };
+        juce::Component root;
+        std::vector<std::unique_ptr<juce::Component>> components;
+        std::vector<jive::StyleSheet::ReferenceCountedPointer> sheets;
+        sheets.push_back(new jive::StyleSheet{ root, state });
+
+        // Groups of panels, each a few levels deep, like the sections of a
+        // large editor.
+        auto parentState = state;
+        auto* parentComponent = &root;
+
+        for (auto i = 0; static_cast<int>(sheets.size()) < numThemedSheets; i++)
+        {
+            if (i % 8 == 0)
+            {
+                parentState = state;
+                parentComponent = &root;
+            }
+
+            juce::ValueTree child{ "Type" + juce::String{ i % numThemeRules }, { { "enabled", true } } };
+            parentState.appendChild(child, nullptr);
+
+            components.push_back(std::make_unique<juce::Component>());
+            parentComponent->addAndMakeVisible(*components.back());
+            sheets.push_back(new jive::StyleSheet{ *components.back(), child });
+
+            parentState = child;
+            parentComponent = components.back().get();
+        }
+
+        const auto start = juce::Time::getHighResolutionTicks();
+        state.setProperty("style", juce::var{ theme.release() }, nullptr);
+        const auto seconds = juce::Time::highResolutionTicksToSeconds(juce::Time::getHighResolutionTicks() - start);
+
+        logMessage(juce::String{ seconds * 1.0e3, 3 } + "ms to apply a theme of " + juce::String{ numThemeRules }
+                   + " rules to " + juce::String{ numThemedSheets } + " sheets");
+        expect(sheets[1]->getBackground().getColour() == juce::Colour{ 0xFF100000 });
+
+        sheets.clear();
+    }
+
+    double benchmarkHover(int numSheets)
+    {
+        beginTest("hover across " + juce::String{ numSheets } + " sheets");
+
+        juce::ValueTree state{
+            "Component",
+            {
+                { "style", R"({ "Button": { "hover": { "background": "#303030" } } })" },
+            },
+        };
+        juce::Component root;
+        std::vector<std::unique_ptr<juce::Component>> components;
+        std::vector<jive::StyleSheet::ReferenceCountedPointer> sheets;
+        sheets.push_back(new jive::StyleSheet{ root, state });
+
+        for (auto i = 0; i < numSheets; i++)
+        {
+            juce::ValueTree child{ "Button", { { "enabled", true } } };
+            state.appendChild(child, nullptr);
+
+            components.push_back(std::make_unique<juce::Component>());
+            root.addAndMakeVisible(*components.back());
+            sheets.push_back(new jive::StyleSheet{ *components.back(), child });
+        }
+
+        const auto start = juce::Time::getHighResolutionTicks();
+
+        for (auto i = 0; i < numHovers; i++)
+        {
+            auto child = state.getChild(i % 100);
+            child.setProperty("mouse", "hover", nullptr);
+            child.setProperty("mouse", "dissociate", nullptr);
+        }
+
+        const auto seconds = juce::Time::highResolutionTicksToSeconds(juce::Time::getHighResolutionTicks() - start);
+        logMessage(juce::String{ seconds * 1.0e6 / numHovers, 2 } + "us per hover in "
+                   + juce::String{ numSheets } + " sheets");
+
+        state.getChild(0).setProperty("mouse", "hover", nullptr);
+        expect(sheets[1]->getBackground().getColour() == juce::Colour{ 0xFF303030 });
+
+        sheets.clear();
+        return seconds;
+    }
+
+    double benchmarkOwnStateRules(int numSheets)
+    {
+        beginTest("hover across " + juce::String{ numSheets } + " sheets with their own state rules");
+
+        juce::ValueTree state{ "Component" };
+        juce::Component root;
+        std::vector<std::unique_ptr<juce::Component>> components;
+        std::vector<jive::StyleSheet::ReferenceCountedPointer> sheets;
+        sheets.push_back(new jive::StyleSheet{ root, state });
+
+        for (auto i = 0; i < numSheets; i++)
+        {
+            juce::ValueTree child{
+                "Button",
+                {
+                    { "enabled", true },
+                    { "style", R"({ "hover": { "background": "#303030" }, "active": { "background": "#404040" } })" },
+                },
+            };
+            state.appendChild(child, nullptr);
+
+            components.push_back(std::make_unique<juce::Component>());
+            root.addAndMakeVisible(*components.back());
+            sheets.push_back(new jive::StyleSheet{ *components.back(), child });
+        }
+
+        const auto start = juce::Time::getHighResolutionTicks();
+
+        for (auto i = 0; i < numHovers; i++)
+        {
+            auto child = state.getChild(i % 100);
+            child.setProperty("mouse", "hover", nullptr);
+            child.setProperty("mouse", "dissociate", nullptr);
+        }
+
+        const auto seconds = juce::Time::highResolutionTicksToSeconds(juce::Time::getHighResolutionTicks() - start);
+        logMessage(juce::String{ seconds * 1.0e6 / numHovers, 2 } + "us per hover among "
+                   + juce::String{ numSheets } + " sheets with their own state rules");
+
+        state.getChild(0).setProperty("mouse", "hover", nullptr);
+        expect(sheets[1]->getBackground().getColour() == juce::Colour{ 0xFF303030 });
+
+        sheets.clear();
+        return seconds;
+    }
+
+    static constexpr auto depth = 200;
+    static constexpr auto numRestyles = 50;
+    static constexpr auto numHovers = 2000;
+    static constexpr auto numThemeRules = 300;
+    static constexpr auto numThemedSheets = 4000;
+};
+
+static StyleSheetBenchmark styleSheetBenchmark;
 #endif
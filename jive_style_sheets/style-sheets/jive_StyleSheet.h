@@ -5,7 +5,7 @@ namespace jive
     class StyleSheet
         : public juce::ReferenceCountedObject
         , private juce::ComponentListener
-        , private juce::ValueTree::Listener
+        , private PropertyDispatcher::Subscriber
         , private Object::Listener
     {
     public:
@@ -21,28 +21,71 @@ namespace jive
         BorderRadii<float> getBorderRadii() const;
         juce::Font getFont() const;
 
+        // The number of times any sheet has applied its styles since the
+        // count was last reset. Useful for seeing how far a change spreads
+        // through a document.
+        static int getNumStylesApplied();
+        static void resetNumStylesApplied();
+
     private:
+        struct ComputedStyle
+        {
+            Fill background;
+            Fill foreground;
+            Fill borderFill;
+            BorderRadii<float> borderRadii;
+            juce::Font font;
+
+            // The values that descendants inherit rather than search for
+            // themselves, i.e. the foreground and font properties.
+            juce::NamedValueSet hereditaryValues;
+        };
+
         void componentMovedOrResized(juce::Component& componentThatWasMovedOrResized, bool wasMoved, bool wasResized) final;
         void componentParentHierarchyChanged(juce::Component& childComponent) final;
         void valueTreePropertyChanged(juce::ValueTree&, const juce::Identifier&) final;
+        void valueTreeParentChanged(juce::ValueTree&) final;
         void propertyChanged(Object& object, const juce::Identifier& name) final;
 
         juce::var findStyleProperty(const juce::Identifier& propertyName) const;
         juce::var findHierarchicalStyleProperty(const juce::Identifier& propertyName) const;
-        juce::ReferenceCountedObjectPtr<StyleSheet> findClosestAncestorStyleSheet();
+        juce::ReferenceCountedObjectPtr<StyleSheet> findClosestAncestorStyleSheet() const;
         juce::Array<ReferenceCountedPointer> collectChildSheets();
 
-        void applyStyles();
+        const ComputedStyle& getComputedStyle() const;
+        ComputedStyle computeStyle() const;
+        void observeStyleObject();
+        void subscribeToStyleChanges();
+        void unsubscribeFromStyleChanges();
+
+        enum class Cascade
+        {
+            // Child sheets are only restyled if a value they inherit changed.
+            inheritedChanges,
+
+            // Every sheet beneath is restyled, e.g. as a rule that could
+            // match any of them may have changed.
+            allDescendants,
+        };
+
+        void applyStyles(Cascade cascade);
+
+        static int& getNumStylesAppliedCounter();
 
         juce::Component::SafePointer<juce::Component> component;
         juce::ValueTree state;
-        juce::ValueTree stateRoot;
         ComponentInteractionState interactionState;
 
         BackgroundCanvas backgroundCanvas;
 
         Property<Object::ReferenceCountedPointer> style;
         Property<float> borderWidth;
+        Object::ReferenceCountedPointer observedStyle;
+        std::vector<PropertyDispatcher::ReferenceCountedPointer> styleDispatchers;
+
+        // Filled on first use and cleared whenever the styles are applied
+        // again.
+        mutable std::optional<ComputedStyle> computedStyle;
 
         const std::unique_ptr<Selectors> selectors;
 
@@ -0,0 +1,146 @@
+#pragma once
+
+#include <juce_core/juce_core.h>
+
+#include <algorithm>
+#include <map>
+#include <numeric>
+
+// Collects the timings of each phase of each benchmark, and writes them as
+// JSON, optionally compared with the results of an earlier run.
+class Results
+{
+public:
+    void add(const juce::String& benchmark, const juce::String& phase, double milliseconds)
+    {
+        if (!benchmarks.count(benchmark))
+            benchmarkOrder.add(benchmark);
+
+        auto& samples = benchmarks[benchmark];
+
+        if (!samples.count(phase))
+            phaseOrder[benchmark].add(phase);
+
+        samples[phase].push_back(milliseconds);
+    }
+
+    // Returns the percentile of the given samples, interpolating linearly
+    // between the closest two ranks.
+    static double getPercentile(std::vector<double> samples, double percentile)
+    {
+        if (samples.empty())
+            return 0.0;
+
+        std::sort(std::begin(samples), std::end(samples));
+
+        const auto rank = percentile / 100.0 * static_cast<double>(samples.size() - 1);
+        const auto lower = static_cast<std::size_t>(std::floor(rank));
+        const auto upper = juce::jmin(lower + 1, samples.size() - 1);
+
+        return samples[lower] + (samples[upper] - samples[lower]) * (rank - static_cast<double>(lower));
+    }
+
+    juce::var toVar() const
+    {
+        juce::Array<juce::var> results;
+
+        for (const auto& benchmark : benchmarkOrder)
+        {
+            const auto& samples = benchmarks.at(benchmark);
+            auto* phases = new juce::DynamicObject;
+
+            for (const auto& phase : phaseOrder.at(benchmark))
+                phases->setProperty(phase, summarise(samples.at(phase)));
+
+            auto* result = new juce::DynamicObject;
+            result->setProperty("name", benchmark);
+            result->setProperty("phases", phases);
+            results.add(result);
+        }
+
+        auto* root = new juce::DynamicObject;
+        root->setProperty("version", 1);
+        root->setProperty("unit", "ms");
+        root->setProperty("benchmarks", results);
+
+        return root;
+    }
+
+    // Adds the relative change in each median compared to the given
+    // baseline, and returns the number of phases whose median grew by more
+    // than the given tolerance.
+    static int compareWithBaseline(juce::var& results, const juce::var& baseline, double tolerance)
+    {
+        auto numRegressions = 0;
+        auto* entries = results["benchmarks"].getArray();
+
+        for (auto i = 0; entries != nullptr && i < entries->size(); i++)
+        {
+            const auto& result = entries->getReference(i);
+            const auto baselinePhases = findBenchmark(baseline, result["name"].toString())["phases"];
+
+            if (auto* phases = result["phases"].getDynamicObject())
+            {
+                for (const auto& phase : phases->getProperties())
+                {
+                    const auto baselineMedian = static_cast<double>(baselinePhases[phase.name]["p50"]);
+
+                    if (baselineMedian <= 0.0)
+                        continue;
+
+                    const auto change = static_cast<double>(phase.value["p50"]) / baselineMedian - 1.0;
+                    const auto isRegression = change > tolerance;
+
+                    if (auto* summary = phase.value.getDynamicObject())
+                    {
+                        summary->setProperty("baseline-p50", baselineMedian);
+                        summary->setProperty("change", change);
+                        summary->setProperty("regression", isRegression);
+                    }
+
+                    if (isRegression)
+                        numRegressions++;
+                }
+            }
+        }
+
+        results.getDynamicObject()->setProperty("regressions", numRegressions);
+        return numRegressions;
+    }
+
+private:
+    static juce::var summarise(const std::vector<double>& samples)
+    {
+        auto* summary = new juce::DynamicObject;
+
+        summary->setProperty("samples", static_cast<int>(samples.size()));
+        summary->setProperty("min", *std::min_element(std::begin(samples), std::end(samples)));
+        summary->setProperty("p50", getPercentile(samples, 50.0));
+        summary->setProperty("p90", getPercentile(samples, 90.0));
+        summary->setProperty("p99", getPercentile(samples, 99.0));
+        summary->setProperty("max", *std::max_element(std::begin(samples), std::end(samples)));
+        summary->setProperty("mean",
+                             std::accumulate(std::begin(samples), std::end(samples), 0.0)
+                                 / static_cast<double>(samples.size()));
+
+        return summary;
+    }
+
+    static juce::var findBenchmark(const juce::var& results, const juce::String& name)
+    {
+        if (const auto* entries = results["benchmarks"].getArray())
+        {
+            for (const auto& benchmark : *entries)
+            {
+                if (benchmark["name"].toString() == name)
+                    return benchmark;
+            }
+        }
+
+        return {};
+    }
+
+    juce::StringArray benchmarkOrder;
+    std::map<juce::String, std::map<juce::String, std::vector<double>>> benchmarks;
+    std::map<juce::String, juce::StringArray> phaseOrder;
+};
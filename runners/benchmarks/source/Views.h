@@ -0,0 +1,185 @@
+#pragma once
+
+#include <jive_layouts/jive_layouts.h>
+
+// Synthetic views, each roughly the size of a large plugin editor, built to
+// stress one part of the layout engine at a time.
+namespace views
+{
+    inline juce::ValueTree createRoot(const juce::NamedValueSet& properties = {})
+    {
+        juce::ValueTree root{
+            "Component",
+            {
+                { "width", 1280 },
+                { "height", 800 },
+            },
+        };
+
+        for (const auto& property : properties)
+            root.setProperty(property.name, property.value, nullptr);
+
+        return root;
+    }
+
+    inline juce::ValueTree createDeepFlex(int depth)
+    {
+        auto root = createRoot();
+        auto parent = root;
+
+        for (auto i = 0; i < depth; i++)
+        {
+            juce::ValueTree child{
+                "Component",
+                {
+                    { "flex-direction", i % 2 == 0 ? "row" : "column" },
+                    { "flex-grow", 1 },
+                    { "padding", 1 },
+                },
+            };
+            parent.appendChild(child, nullptr);
+            parent = child;
+        }
+
+        parent.appendChild(juce::ValueTree{ "Component", { { "width", 10 }, { "height", 10 } } }, nullptr);
+
+        return root;
+    }
+
+    inline juce::ValueTree createWideFlex(int numChildren)
+    {
+        auto root = createRoot({
+            { "flex-direction", "row" },
+            { "flex-wrap", "wrap" },
+            { "align-content", "flex-start" },
+        });
+
+        for (auto i = 0; i < numChildren; i++)
+        {
+            root.appendChild(juce::ValueTree{
+                                 "Component",
+                                 {
+                                     { "width", 20 + i % 7 },
+                                     { "height", 20 },
+                                     { "margin", 1 },
+                                 },
+                             },
+                             nullptr);
+        }
+
+        return root;
+    }
+
+    inline juce::ValueTree createGrid(int numTracks)
+    {
+        juce::StringArray tracks;
+
+        for (auto i = 0; i < numTracks; i++)
+            tracks.add("1fr");
+
+        auto root = createRoot({
+            { "display", "grid" },
+            { "gap", 2 },
+            { "grid-template-columns", tracks.joinIntoString(" ") },
+            { "grid-template-rows", tracks.joinIntoString(" ") },
+        });
+
+        for (auto i = 0; i < numTracks * numTracks; i++)
+            root.appendChild(juce::ValueTree{ "Component", { { "margin", i % 3 } } }, nullptr);
+
+        return root;
+    }
+
+    inline juce::ValueTree createBlock(int numChildren)
+    {
+        auto root = createRoot({ { "display", "block" } });
+        juce::Random random{ 42 };
+
+        for (auto i = 0; i < numChildren; i++)
+        {
+            root.appendChild(juce::ValueTree{
+                                 "Component",
+                                 {
+                                     { "x", juce::String{ random.nextInt(95) } + "%" },
+                                     { "y", random.nextInt(760) },
+                                     { "width", 16 + random.nextInt(48) },
+                                     { "height", "5%" },
+                                 },
+                             },
+                             nullptr);
+        }
+
+        return root;
+    }
+
+    inline juce::ValueTree createText(int numLabels)
+    {
+        auto root = createRoot({
+            { "flex-direction", "row" },
+            { "flex-wrap", "wrap" },
+            { "align-content", "flex-start" },
+        });
+
+        for (auto i = 0; i < numLabels; i++)
+        {
+            root.appendChild(juce::ValueTree{
+                                 "Text",
+                                 {
+                                     { "text", "Channel " + juce::String{ i } + (i % 3 == 0 ? " - Gain Reduction" : "") },
+                                     { "margin", 2 },
+                                 },
+                             },
+                             nullptr);
+        }
+
+        return root;
+    }
+
+    inline juce::ValueTree createStyled(int numChildren)
+    {
+        auto root = createRoot({
+            { "flex-direction", "row" },
+            { "flex-wrap", "wrap" },
+            { "align-content", "flex-start" },
+            { "style", R"({
+                "background": "#1E1E1E",
+                "foreground": "#F0F0F0",
+                "font-size": 13,
+                "Component": {
+                    "border": "#505050",
+                    "border-radius": 3
+                }
+            })" },
+        });
+
+        for (auto i = 0; i < numChildren; i++)
+        {
+            root.appendChild(juce::ValueTree{
+                                 "Component",
+                                 {
+                                     { "width", 60 },
+                                     { "height", 30 },
+                                     { "margin", 2 },
+                                     { "padding", 4 },
+                                     { "border-width", 1 },
+                                     { "style", R"({
+                                         "background": "#2D2D2D",
+                                         "hover": {
+                                             "background": "#3C3C3C",
+                                             "foreground": "#FFFFFF"
+                                         },
+                                         "active": {
+                                             "background": "#0E639C"
+                                         }
+                                     })" },
+                                 },
+                                 {
+                                     juce::ValueTree{ "Text", { { "text", juce::String{ i } } } },
+                                 },
+                             },
+                             nullptr);
+        }
+
+        return root;
+    }
+} // namespace views
@@ -0,0 +1,229 @@
+#include "Results.h"
+#include "Views.h"
+
+#include <juce_gui_basics/juce_gui_basics.h>
+#include <jive_layouts/jive_layouts.h>
+
+#include <iostream>
+
+struct Scenario
+{
+    juce::String name;
+    std::function<juce::ValueTree()> createView;
+
+    // Changes a single property that requires some of the view to be laid
+    // out again.
+    std::function<void(juce::ValueTree& view)> changeProperty;
+};
+
+static std::vector<Scenario> createScenarios()
+{
+    return {
+        {
+            "deep-flex",
+            []() {
+                return views::createDeepFlex(100);
+            },
+            [](juce::ValueTree& view) {
+                auto leaf = view;
+
+                while (leaf.getNumChildren() > 0)
+                    leaf = leaf.getChild(0);
+
+                leaf.setProperty("width", 20, nullptr);
+            },
+        },
+        {
+            "wide-flex",
+            []() {
+                return views::createWideFlex(2000);
+            },
+            [](juce::ValueTree& view) {
+                view.getChild(0).setProperty("width", 40, nullptr);
+            },
+        },
+        {
+            "grid",
+            []() {
+                return views::createGrid(32);
+            },
+            [](juce::ValueTree& view) {
+                view.getChild(0).setProperty("margin", 5, nullptr);
+            },
+        },
+        {
+            "block",
+            []() {
+                return views::createBlock(2000);
+            },
+            [](juce::ValueTree& view) {
+                view.getChild(0).setProperty("x", "50%", nullptr);
+            },
+        },
+        {
+            "text",
+            []() {
+                return views::createText(1500);
+            },
+            [](juce::ValueTree& view) {
+                view.getChild(0).setProperty("text", "Master - Gain Reduction", nullptr);
+            },
+        },
+        {
+            "styled",
+            []() {
+                return views::createStyled(1000);
+            },
+            [](juce::ValueTree& view) {
+                view.getChild(0).setProperty("width", 80, nullptr);
+            },
+        },
+    };
+}
+
+template <typename Function>
+static double timeMilliseconds(Function&& function)
+{
+    const auto start = juce::Time::getHighResolutionTicks();
+    function();
+    return juce::Time::highResolutionTicksToSeconds(juce::Time::getHighResolutionTicks() - start) * 1000.0;
+}
+
+static juce::String getOption(const juce::StringArray& arguments,
+                              const juce::String& option,
+                              const juce::String& valueIfMissing = {})
+{
+    const auto index = arguments.indexOf(option);
+
+    if (index < 0 || index + 1 >= arguments.size())
+        return valueIfMissing;
+
+    return arguments[index + 1];
+}
+
+class BenchmarkRunner : public juce::JUCEApplication
+{
+public:
+    const juce::String getApplicationName() final
+    {
+        return "JIVE Benchmarks";
+    }
+
+    const juce::String getApplicationVersion() final
+    {
+        return "1.0.0";
+    }
+
+    void initialise(const juce::String&) final
+    {
+        const auto arguments = getCommandLineParameterArray();
+
+        if (arguments.contains("--help"))
+        {
+            std::cout << "Usage: jive-benchmarks [--iterations <n>] [--filter <name>] "
+                         "[--output <file>] [--baseline <file>] [--tolerance <fraction>]\n";
+            quit();
+            return;
+        }
+
+        const auto numIterations = juce::jmax(1, getOption(arguments, "--iterations", "20").getIntValue());
+        const auto filter = getOption(arguments, "--filter");
+
+        Results results;
+
+        for (const auto& scenario : createScenarios())
+        {
+            if (filter.isNotEmpty() && !scenario.name.contains(filter))
+                continue;
+
+            // The first run pays for one-off costs like loading fonts and
+            // parsing style sheets into the caches, so isn't recorded.
+            run(scenario, nullptr);
+
+            for (auto i = 0; i < numIterations; i++)
+                run(scenario, &results);
+        }
+
+        auto json = results.toVar();
+        auto numRegressions = 0;
+
+        if (const auto baselinePath = getOption(arguments, "--baseline"); baselinePath.isNotEmpty())
+        {
+            const auto baseline = juce::JSON::parse(juce::File::getCurrentWorkingDirectory()
+                                                        .getChildFile(baselinePath)
+                                                        .loadFileAsString());
+            const auto tolerance = getOption(arguments, "--tolerance", "0.1").getDoubleValue();
+
+            numRegressions = Results::compareWithBaseline(json, baseline, tolerance);
+        }
+
+        const auto text = juce::JSON::toString(json);
+
+        if (const auto outputPath = getOption(arguments, "--output"); outputPath.isNotEmpty())
+        {
+            juce::File::getCurrentWorkingDirectory()
+                .getChildFile(outputPath)
+                .replaceWithText(text);
+        }
+        else
+        {
+            std::cout << text << "\n";
+        }
+
+        if (numRegressions > 0)
+            std::cerr << juce::String{ numRegressions } << " phases regressed compared to the baseline\n";
+
+        setApplicationReturnValue(numRegressions);
+        quit();
+    }
+
+    void shutdown() final
+    {
+    }
+
+    bool moreThanOneInstanceAllowed() final
+    {
+        return true;
+    }
+
+private:
+    static void run(const Scenario& scenario, Results* results)
+    {
+        const auto record = [&scenario, results](const juce::String& phase, double milliseconds) {
+            if (results != nullptr)
+                results->add(scenario.name, phase, milliseconds);
+        };
+
+        auto view = scenario.createView();
+        jive::Interpreter interpreter;
+        std::unique_ptr<jive::GuiItem> item;
+
+        // Creating the items within a transaction defers measuring and laying
+        // them out until it's committed, so the two can be timed separately.
+        auto transaction = std::make_unique<jive::StateTransaction>();
+
+        record("interpret", timeMilliseconds([&]() {
+                   item = interpreter.interpret(view);
+               }));
+        record("first-layout", timeMilliseconds([&]() {
+                   transaction.reset();
+                   jive::LayoutScheduler::flushLayoutNow();
+               }));
+        record("relayout", timeMilliseconds([&]() {
+                   scenario.changeProperty(view);
+                   jive::LayoutScheduler::flushLayoutNow();
+               }));
+
+        auto hovered = view.getNumChildren() > 0 ? view.getChild(0) : view;
+        record("hover-restyle", timeMilliseconds([&]() {
+                   hovered.setProperty("mouse", "hover", nullptr);
+                   jive::LayoutScheduler::flushLayoutNow();
+               }));
+
+        record("teardown", timeMilliseconds([&]() {
+                   item.reset();
+               }));
+    }
+};
+
+START_JUCE_APPLICATION(BenchmarkRunner)
@@ -1,3 +1,4 @@
+#include <jive_core/jive_core.h>
 #include <juce_gui_basics/juce_gui_basics.h>
 
 class TestRunner
@@ -21,9 +22,21 @@ public:
         return "1.0.0";
     }
 
-    void initialise(const juce::String&) final
+    void initialise(const juce::String& commandLine) final
     {
-        runTestsInCategory("jive");
+        if (commandLine.contains("--micro-benchmarks"))
+        {
+#if JIVE_LAYOUT_STATS
+            // Keeps the cost of recording layout stats out of the timings.
+            jive::LayoutStats::setEnabled(false);
+#endif
+            runTestsInCategory("jive-micro-benchmarks");
+        }
+        else
+        {
+            runTestsInCategory("jive");
+        }
+
         logSuccessOrFailure();
         setApplicationReturnValue(getNumFailures());
         quit();